@@ -140,4 +140,16 @@ void AABB2D::Draw()
 	//the pixel scale value is already integrated when the dimension is set earlier
 	TheDebug::Instance()->DrawCube2D(m_dimension.X, m_dimension.Y, m_color, 1);
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns world space box around bound
+//------------------------------------------------------------------------------------------------------
+bool AABB2D::GetExtent(Vector3D<float>& min, Vector3D<float>& max) const
+{
+
+	min = Vector3D<float>(m_min.X, m_min.Y, m_position.Z);
+	max = Vector3D<float>(m_max.X, m_max.Y, m_position.Z);
+
+	return true;
+
 }
\ No newline at end of file
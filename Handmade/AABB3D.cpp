@@ -146,4 +146,16 @@ void AABB3D::Draw()
 	//draw bound based on dimension and color set 
 	TheDebug::Instance()->DrawCube3D(m_dimension.X, m_dimension.Y, m_dimension.Z, m_color);
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns world space box around bound
+//------------------------------------------------------------------------------------------------------
+bool AABB3D::GetExtent(Vector3D<float>& min, Vector3D<float>& max) const
+{
+
+	min = m_min;
+	max = m_max;
+
+	return true;
+
 }
\ No newline at end of file
@@ -7,8 +7,9 @@
 Animation::Animation()
 {
 
-	//set sprite to dynamic by default 
-	m_spriteType = DYNAMIC;
+	//the sprite data only shows the first texture cell and does not change when 
+	//moving on to other cells, so it is static and kept in the buffer's own VBO
+	m_spriteType = STATIC;
 
 	//set other default values
 	m_isAnimationDead = false;
@@ -51,7 +52,8 @@ void Animation::Draw()
 {
 
 	//store the total time elapsed since animation began which will be used in formula below
-	m_timeElapsed += TheTime::Instance()->GetElapsedTimeSeconds();
+	//the frame time is used because this may run while another thread updates with the fixed step
+	m_timeElapsed += TheTime::Instance()->GetFrameTimeSeconds();
 
 	//aquire index value of specific texture cell to "cut out" using a formula
 	m_textureIndex = (GLint)(m_timeElapsed * m_animationVelocity) %
@@ -87,16 +89,33 @@ void Animation::Draw()
 	if (!m_isAnimationDead)
 	{
 
-		//clear all buffer data from vectors
-		ClearBufferData();
+		//only create the sprite data if it has changed
+		//the data is always created for the first texture cell
+		if (IsDataChanged())
+		{
 
-		//create the vertex, texture and color buffer data
-		CreateVertices();
-		CreateTexCoords();
-		CreateColors();
+			GLint textureIndex = m_textureIndex;
+			m_textureIndex = 0;
 
-		//fill the VBOs with the buffer data
-		FillBuffers();
+			//clear all buffer data from vectors
+			ClearBufferData();
+
+			//create the vertex, texture and color buffer data
+			CreateVertices();
+			CreateTexCoords();
+			CreateColors();
+
+			//fill the VBOs with the buffer data
+			FillBuffers();
+			StoreCreatedData();
+
+			m_textureIndex = textureIndex;
+
+		}
+
+		//move the texture coordinates from the first texture cell onto the current one
+		m_textureOffset.X = (GLfloat)(m_textureIndex % m_textureDimension.X) / m_textureDimension.X;
+		m_textureOffset.Y = (GLfloat)(m_textureIndex / m_textureDimension.X) / m_textureDimension.Y;
 
 		//create and draw the sprite
 		CreateSprite();
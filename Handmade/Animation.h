@@ -30,6 +30,11 @@
   set to end. This is because if we were to end it at the last cell, the last cell wouldn't be drawn
   so instead we let the entire spritesheet draw before killing the animation.
 
+- The sprite data of an animation is only created once, showing the first texture cell, and is 
+  only created again if the animation's color or dimensions change. To show the current texture 
+  cell, the Draw() routine sets the sprite's texture offset, which is added to the texture 
+  coordinates by the sprite batch or the shader, instead of creating all sprite data every frame.
+
 */
 
 #ifndef ANIMATION_H
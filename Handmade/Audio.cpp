@@ -19,7 +19,7 @@ Audio::Audio()
 	m_loopCount = NO_LOOP;
 
 	m_channel = 0;
-	m_audioData = 0;
+	m_audio = Handle();
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -55,14 +55,15 @@ float& Audio::Frequency()
 unsigned int Audio::GetLength()
 {
 
-	//temp variable to hold length
+	//temp variables to hold length and audio data
 	unsigned int length = 0;
+	FMOD::Sound* audioData = TheAudio::Instance()->GetAudioData(m_audio);
 
 	//if audio data is valid get length of
 	//audio object and store in temp variable
-	if(m_audioData)
+	if(audioData)
 	{
-		m_audioData->getLength(&length, FMOD_TIMEUNIT_MS);
+		audioData->getLength(&length, FMOD_TIMEUNIT_MS);
 	}
 
 	return length;
@@ -124,12 +125,12 @@ void Audio::SetLoopCount(Loop loopType, Loop loopCount)
 
 }
 //------------------------------------------------------------------------------------------------------
-//setter function that assigns FMOD pointer to audio object based on index value and audio type passed
+//setter function that assigns FMOD audio handle to audio object based on index value and audio type passed
 //------------------------------------------------------------------------------------------------------
 void Audio::SetAudioData(const std::string& mapIndex, AudioManager::AudioType audioType)
 {
 
-	m_audioData = TheAudio::Instance()->GetAudioData(audioType, mapIndex);
+	m_audio = TheAudio::Instance()->GetAudio(audioType, mapIndex);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -183,8 +184,8 @@ bool Audio::Play()
 	//then use the audio manager to play the audio sound, as we don't want multiple sounds playing! 
 	if (!m_channel || (GetPosition() == 0))
 	{
-		TheAudio::Instance()->
-		GetAudioSystem()->playSound(m_audioData, m_channelGroup, false, &m_channel);
+		TheAudio::Instance()->GetAudioSystem()->
+		playSound(TheAudio::Instance()->GetAudioData(m_audio), m_channelGroup, false, &m_channel);
 	}
 
 	//if no channel was generated, display error message and return false
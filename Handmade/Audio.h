@@ -27,8 +27,9 @@
   calling client code. The other two regular getter functions return the length and position of the
   audio (when being played). This measurement is in milliseconds. 
 
-- The SetAudioData() function is used to assign the FMOD audio data to the audio object. This data is
-  requested from the Audio Manager.
+- The SetAudioData() function is used to assign the FMOD audio data to the audio object. A handle to
+  this data is requested from the Audio Manager, and the data is looked up through the handle when 
+  the audio is played, so that audio that has been unloaded since is never played by mistake.
 
 - The Play() function is main routine that will play the audio using the Audio Manager's FMOD audio 
   handle. Once the audio plays, it will generate a new channel and the channel handle can then be
@@ -103,7 +104,7 @@ private :
 	bool m_isMute;
 	Loop m_loopCount;
 
-	FMOD::Sound* m_audioData;
+	Handle m_audio;
 	FMOD::Channel* m_channel;
 	FMOD::ChannelGroup* m_channelGroup;
 					
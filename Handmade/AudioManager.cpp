@@ -20,30 +20,55 @@ FMOD::System* AudioManager::GetAudioSystem()
 
 }
 //------------------------------------------------------------------------------------------------------
-//getter function that returns audio object based on audio map index passed 
+//getter function that returns audio handle based on audio type and map index passed 
 //------------------------------------------------------------------------------------------------------
-FMOD::Sound* AudioManager::GetAudioData(AudioType audioType, const std::string& mapIndex)
+Handle AudioManager::GetAudio(AudioType audioType, const std::string& mapIndex)
 {
 
-	switch (audioType)
+	std::lock_guard<std::mutex> lock(m_audioMutex);
+
+	std::map<std::string, Handle>* tempMap = GetHandleMap(audioType);
+	auto it = tempMap->find(mapIndex);
+
+	//if audio does not exist, display error message and return a null handle
+	if (it == tempMap->end())
 	{
-		case SFX_AUDIO   : return m_sfxDataMap[mapIndex]; break;
-		case MUSIC_AUDIO : return m_musicDataMap[mapIndex]; break;
-		case VOICE_AUDIO : return m_voiceDataMap[mapIndex]; break;
+		std::cout << "Audio \"" << mapIndex << "\" does not exist." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return Handle();
 	}
 
-	return 0;
+	return it->second;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns audio object based on audio handle passed or null if it is stale
+//------------------------------------------------------------------------------------------------------
+FMOD::Sound* AudioManager::GetAudioData(Handle audio)
+{
+
+	std::lock_guard<std::mutex> lock(m_audioMutex);
+
+	FMOD::Sound** audioData = m_audioData.Get(audio);
+	return (audioData ? *audioData : 0);
 
 }
 //------------------------------------------------------------------------------------------------------
 //function that initializes all audio subsystems 
 //------------------------------------------------------------------------------------------------------
-bool AudioManager::Initialize()
+bool AudioManager::Initialize(bool headless)
 {
 
 	//create audio subsystem and store handle in pointer	
 	System_Create(&m_audioSystem);
 
+	//in headless mode never output any audio and mix it 
+	//only when the system is updated instead of in real time
+	if (headless)
+	{
+		m_audioSystem->setOutput(FMOD_OUTPUTTYPE_NOSOUND_NRT);
+	}
+
 	//initialize audio sub system with 100 channels and normal flag
 	//if initialization failed, display error message and return false
 	if(m_audioSystem->init(100, FMOD_INIT_NORMAL, 0) != FMOD_OK)
@@ -90,13 +115,15 @@ bool AudioManager::LoadFromFile(const std::string& filename, AudioType audioType
 		return false;
 	}
 
-	//if loading succeeded, add temporary audio data pointer to map accordingly
-	switch (audioType)
-	{
-		case SFX_AUDIO   : m_sfxDataMap[mapIndex] = audioData; break;
-		case MUSIC_AUDIO : m_musicDataMap[mapIndex] = audioData; break;
-		case VOICE_AUDIO : m_voiceDataMap[mapIndex] = audioData; break;
-	}
+	//if audio is already loaded under the same name, unload it first, 
+	//so that any handles still referring to the old audio become stale
+	UnloadFromMemory(audioType, CUSTOM_AUDIO, mapIndex);
+
+	//if loading succeeded, add temporary audio data pointer to slot 
+	//map and its handle to the map accordingly
+	m_audioMutex.lock();
+	(*GetHandleMap(audioType))[mapIndex] = m_audioData.Add(audioData);
+	m_audioMutex.unlock();
 		
 	//display text to state that file has been opened and read
 	std::cout << "File opened and read successfully." << std::endl;
@@ -121,18 +148,11 @@ void AudioManager::UnloadFromMemory(AudioType audioType,
 	                                RemoveType removeType, const std::string& mapIndex)
 {
 
-	//temp pointer which will reference specific audio map
-	std::map<std::string, FMOD::Sound*>* tempMap = 0;
+	std::lock_guard<std::mutex> lock(m_audioMutex);
 
-	//assign whichever audio map needs to be removed from 
-	//to temp pointer so that when looping through the map later, 
-	//the pointer is used instead of looping through three different maps
-	switch (audioType)
-	{
-		case SFX_AUDIO   : tempMap = &m_sfxDataMap; break;
-		case MUSIC_AUDIO : tempMap = &m_musicDataMap; break;
-		case VOICE_AUDIO : tempMap = &m_voiceDataMap; break;
-	}
+	//temp pointer which will reference specific audio handle map
+	//so that the pointer is used instead of three different maps
+	std::map<std::string, Handle>* tempMap = GetHandleMap(audioType);
 
 	//loop through entire audio map in order 
 	//to remove a specific audio object or all audio objects
@@ -141,13 +161,14 @@ void AudioManager::UnloadFromMemory(AudioType audioType,
 
 		//if a flag is passed to remove a specific audio object
 		//check if map index is the audio that needs to be removed
-		//and remove it from both FMOD and the map
+		//and remove it from FMOD, the slot map and the map
 		if (removeType == CUSTOM_AUDIO)
 		{
 
 			if (it->first == mapIndex)
 			{
-				it->second->release();
+				(*m_audioData.Get(it->second))->release();
+				m_audioData.Remove(it->second);
 				tempMap->erase(it);
 				break;
 			}
@@ -155,10 +176,11 @@ void AudioManager::UnloadFromMemory(AudioType audioType,
 		}
 
 		//otherwise if a flag is passed to remove all audio objects
-		//remove the audio from FMOD
+		//remove the audio from FMOD and the slot map
 		else if (removeType == ALL_AUDIO)
 		{
-			it->second->release();
+			(*m_audioData.Get(it->second))->release();
+			m_audioData.Remove(it->second);
 		}
 
 	}
@@ -179,6 +201,22 @@ void AudioManager::ShutDown()
 
 	m_audioSystem->release();
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that returns the handle map of the audio type passed
+//------------------------------------------------------------------------------------------------------
+std::map<std::string, Handle>* AudioManager::GetHandleMap(AudioType audioType)
+{
+
+	switch (audioType)
+	{
+		case SFX_AUDIO   : return &m_sfxDataMap;
+		case MUSIC_AUDIO : return &m_musicDataMap;
+		case VOICE_AUDIO : return &m_voiceDataMap;
+	}
+
+	return &m_sfxDataMap;
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that displays total size of all audio data maps
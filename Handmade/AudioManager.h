@@ -11,8 +11,8 @@
   -----------------------------------------------------------------------------------------------
 
 - This class encapsulates an audio manager which will load music, sound effects and voice audio
-  files from disk and store them as FMOD sound objects in a map, with a string reference to that
-  audio object. Currently the audio files supported are MP3, WAV, OGG, FLAC, <TBA>. To access any
+  files from disk and store them as FMOD sound objects in a slot map, with a string reference to 
+  that audio object kept in one of three maps. Currently the audio files supported are MP3, WAV, OGG, FLAC, <TBA>. To access any
   particular audio inside the map the string reference is needed to sift through the map and find 
   the audio. Audio objects can also be unloaded from memory individually or in bulk. This class is 
   a Singleton. The main member variable is m_audioSystem, which is a handle on the entire FMOD audio
@@ -25,8 +25,10 @@
 
 - To use this class, a Audio object needs to be created inside the game client code. Then that
   audio object will be able to link to a specific FMOD audio object from within the Audio Manager.
-  The GetAudioData() function is used to request the FMOD sound pointer and link the audio data with
-  the audio object. The other getter routine GetAudioSystem() will return the FMOD audio system pointer
+  The GetAudio() function is used once to look up the audio by its type and string reference and
+  returns a handle to it, or a null handle if there is no such audio. The GetAudioData() function
+  then returns the FMOD sound pointer from the handle each time the audio is used, which is a simple
+  array lookup, or a null pointer if the audio has been unloaded since. The other getter routine GetAudioSystem() will return the FMOD audio system pointer
   which is used inside the Audio class' Play() function to play audio. 
 
 - The LoadFromFile() routine will load in the audio data from a file and store the audio in the 
@@ -34,6 +36,13 @@
   as to save on memory beacuse these files can become plentiful and large. SFX files are loaded
   in directly into memory and kept there. Streamed audio is CPU intensive!
 
+- The audio maps are guarded by a mutex, so that LoadFromFile() may also be called on a loading
+  thread, while a game state is being preloaded. FMOD itself is thread safe.
+
+- When initialized in headless mode, the FMOD system is set up without any sound output. All audio
+  is still loaded and played as normal, but it is never sent to a sound card, which makes this a
+  null backend for machines without any audio devices.
+
 - An Output() routine is there for debug purposes only and will print to the console how many audio
   objects are currently stored in each of the three supported maps.
 
@@ -43,10 +52,12 @@
 #define AUDIO_MANAGER_H
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <fmod.hpp>
 #include "Singleton.h"
+#include "SlotMap.h"
 
 class AudioManager
 {
@@ -63,11 +74,12 @@ public:
 public :
 
 	FMOD::System* GetAudioSystem();
-	FMOD::Sound* GetAudioData(AudioType audioType, const std::string& mapIndex);
+	Handle GetAudio(AudioType audioType, const std::string& mapIndex);
+	FMOD::Sound* GetAudioData(Handle audio);
 
 public :
 
-	bool Initialize();
+	bool Initialize(bool headless = false);
 	bool LoadFromFile(const std::string& filename, AudioType audioType, const std::string& mapIndex);
 
 public :
@@ -89,13 +101,20 @@ private:
 	AudioManager(const AudioManager&);
 	AudioManager& operator=(const AudioManager&);
 
+private:
+
+	std::map<std::string, Handle>* GetHandleMap(AudioType audioType);
+
 private :
 
 	FMOD::System* m_audioSystem;
+	std::mutex m_audioMutex;
 	
-	std::map<std::string, FMOD::Sound*> m_sfxDataMap;
-	std::map<std::string, FMOD::Sound*> m_musicDataMap;	
-	std::map<std::string, FMOD::Sound*> m_voiceDataMap;	
+	SlotMap<FMOD::Sound*> m_audioData;
+
+	std::map<std::string, Handle> m_sfxDataMap;
+	std::map<std::string, Handle> m_musicDataMap;	
+	std::map<std::string, Handle> m_voiceDataMap;	
 
 };
 
@@ -8,6 +8,15 @@ Vector3D<float> Bound::GetPosition() const
 
 	return m_position;
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns world space box around bound, if it has one
+//------------------------------------------------------------------------------------------------------
+bool Bound::GetExtent(Vector3D<float>& /*min*/, Vector3D<float>& /*max*/) const
+{
+
+	return false;
+
 }
 //------------------------------------------------------------------------------------------------------
 //setter function that assigns color of bound
@@ -38,6 +38,10 @@
   elsewhere in the derived bound class code. The code in the derived bound classes require that the 
   GetPosition() routine remains a constant function!
 
+- The GetExtent() function returns the smallest world space box that fits around the bound, which
+  is used to check if the bound is on screen at all. Bounds that enclose an area override it and 
+  return true. Lines and planes have no area to enclose and keep the base version returning false.
+
 */
 
 #ifndef BOUND_H
@@ -57,6 +61,7 @@ public :
 public :
 
 	Vector3D<float> GetPosition() const;
+	virtual bool GetExtent(Vector3D<float>& min, Vector3D<float>& max) const;
 
 public :
 
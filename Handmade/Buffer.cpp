@@ -1,6 +1,8 @@
 #include "Buffer.h"
 #include "BufferManager.h"
 #include "ShaderManager.h"
+#include "SpriteBatch.h"
+#include "StreamBuffer.h"
 
 //------------------------------------------------------------------------------------------------------
 //constructor that assigns all defaults
@@ -8,21 +10,93 @@
 Buffer::Buffer()
 {
 
-	m_vertexBufferID = 0;
-	m_colorBufferID = 0;
-	m_normalBufferID = 0;
-	m_textureBufferID = 0;
+	m_vertexBuffer = Handle();
+	m_colorBuffer = Handle();
+	m_normalBuffer = Handle();
+	m_textureBuffer = Handle();
 
 	m_vertexAttributeID = 0;
 	m_colorAttributeID = 0;
 	m_normalAttributeID = 0;
 	m_textureAttributeID = 0;
+	m_instanceMatrixAttributeID = -1;
+	m_instanceColorAttributeID = -1;
 
 	m_vertexComponentSize = XYZ;
 	m_colorComponentSize = RGB;
 	m_normalComponentSize = XYZ;
 	m_textureComponentSize = UV;
 
+	m_isInterleaved = false;
+	m_isDataDirty = false;
+	m_isLayoutDirty = true;
+	m_isStreamed = false;
+	m_isInstanceDirty = false;
+
+	m_interleavedBufferID = 0;
+	m_vertexArrayID = 0;
+	m_vertexArrayBufferID = 0;
+	m_indexBufferID = 0;
+	m_instanceBufferID = 0;
+
+	m_firstVertex = 0;
+	m_streamFrame = 0;
+
+	m_totalVertices = 0;
+	m_stride = 0;
+	m_colorOffset = -1;
+	m_normalOffset = -1;
+	m_textureOffset = -1;
+
+	m_indexType = GL_UNSIGNED_INT;
+	m_totalIndices = 0;
+	m_totalInstances = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//destructor that destroys the buffer's own VBOs and VAO if it created them
+//------------------------------------------------------------------------------------------------------
+Buffer::~Buffer()
+{
+
+	if (m_interleavedBufferID)
+	{
+		TheBuffer::Instance()->DestroyBuffer(m_interleavedBufferID);
+	}
+
+	if (m_indexBufferID)
+	{
+		TheBuffer::Instance()->DestroyBuffer(m_indexBufferID);
+	}
+
+	if (m_instanceBufferID)
+	{
+		TheBuffer::Instance()->DestroyBuffer(m_instanceBufferID);
+	}
+
+	if (m_vertexArrayID)
+	{
+		TheBuffer::Instance()->DestroyVertexArray(m_vertexArrayID);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter-setter function that returns interleaved flag reference
+//------------------------------------------------------------------------------------------------------
+bool& Buffer::IsInterleaved()
+{
+
+	return m_isInterleaved;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter/setter function that returns streamed flag reference
+//------------------------------------------------------------------------------------------------------
+bool& Buffer::IsStreamed()
+{
+
+	return m_isStreamed;
+
 }
 //------------------------------------------------------------------------------------------------------
 //getter-setter function that returns reference to vector of vertices 
@@ -61,41 +135,55 @@ std::vector<GLfloat>& Buffer::Textures()
 
 }
 //------------------------------------------------------------------------------------------------------
-//setter function that assigns OpenGL VBO ID value to buffer object
+//getter-setter function that returns reference to vector of vertex indices 
+//------------------------------------------------------------------------------------------------------
+std::vector<GLuint>& Buffer::Indices()
+{
+
+	return m_indices;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter-setter function that returns reference to vector of per-instance data 
+//------------------------------------------------------------------------------------------------------
+std::vector<GLfloat>& Buffer::Instances()
+{
+
+	return m_instances;
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns OpenGL VBO handle to buffer object
 //------------------------------------------------------------------------------------------------------
 void Buffer::SetBufferID(BufferType bufferType, const std::string& mapIndex)
 {
 
-	//based on which type of VBO ID needs to be assigned get the ID 
+	//based on which type of VBO needs to be assigned get its handle 
 	//from the Buffer Manager based on index value passed and assign it 
 	switch (bufferType)
 	{
 
 		case VERTEX_BUFFER:
 		{
-			m_vertexBufferID = TheBuffer::Instance()->
-							   GetBufferID(BufferManager::VERTEX_BUFFER, mapIndex);
+			m_vertexBuffer = TheBuffer::Instance()->GetBuffer(BufferManager::VERTEX_BUFFER, mapIndex);
 			break;
 		}
 
 		case COLOR_BUFFER:
 		{
-			m_colorBufferID = TheBuffer::Instance()->
-					          GetBufferID(BufferManager::COLOR_BUFFER, mapIndex);
+			m_colorBuffer = TheBuffer::Instance()->GetBuffer(BufferManager::COLOR_BUFFER, mapIndex);
 			break;
 		}
 
 		case NORMAL_BUFFER:
 		{
-			m_normalBufferID = TheBuffer::Instance()->
-					           GetBufferID(BufferManager::NORMAL_BUFFER, mapIndex);
+			m_normalBuffer = TheBuffer::Instance()->GetBuffer(BufferManager::NORMAL_BUFFER, mapIndex);
 			break;
 		}
 
 		case TEXTURE_BUFFER:
 		{
-			m_textureBufferID = TheBuffer::Instance()->
-					            GetBufferID(BufferManager::TEXTURE_BUFFER, mapIndex);
+			m_textureBuffer = TheBuffer::Instance()->GetBuffer(BufferManager::TEXTURE_BUFFER, mapIndex);
 			break;
 		}
 
@@ -103,38 +191,69 @@ void Buffer::SetBufferID(BufferType bufferType, const std::string& mapIndex)
 
 }
 //------------------------------------------------------------------------------------------------------
-//setter function that assigns shader attribute ID value to buffer object
+//getter function that returns shader attribute ID value of buffer object
+//------------------------------------------------------------------------------------------------------
+GLint Buffer::GetAttributeID(BufferType bufferType)
+{
+
+	switch (bufferType)
+	{
+		case VERTEX_BUFFER  : return m_vertexAttributeID;
+		case COLOR_BUFFER   : return m_colorAttributeID;
+		case NORMAL_BUFFER  : return m_normalAttributeID;
+		case TEXTURE_BUFFER : return m_textureAttributeID;
+	}
+
+	return -1;
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns shader attribute ID value to buffer object based on name passed
 //------------------------------------------------------------------------------------------------------
 void Buffer::SetAttributeID(BufferType bufferType, const std::string& mapIndex)
 {
 
-	//based on which type of shader attribute ID needs to be assigned get the ID 
-	//from the Shader Manager based on index value passed and assign it 
+	//get the ID from the Shader Manager based on index value passed and assign it 
 	//the correct shaders need to be attached and linked before using them here!
+	SetAttributeID(bufferType, TheShader::Instance()->GetAttribute(mapIndex));
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns shader attribute ID value to buffer object
+//------------------------------------------------------------------------------------------------------
+void Buffer::SetAttributeID(BufferType bufferType, GLint attributeID)
+{
+
+	//based on which type of shader attribute ID needs to be assigned assign it 
+	//the VAO only needs to be set up again if a different attribute is linked
 	switch (bufferType)
 	{
 
 		case VERTEX_BUFFER:
 		{
-			m_vertexAttributeID = TheShader::Instance()->GetAttribute(mapIndex);
+			m_isLayoutDirty = (m_isLayoutDirty || m_vertexAttributeID != attributeID);
+			m_vertexAttributeID = attributeID;
 			break;
 		}
 
 		case COLOR_BUFFER:
 		{
-			m_colorAttributeID = TheShader::Instance()->GetAttribute(mapIndex);
+			m_isLayoutDirty = (m_isLayoutDirty || m_colorAttributeID != attributeID);
+			m_colorAttributeID = attributeID;
 			break;
 		}
 
 		case NORMAL_BUFFER:
 		{
-			m_normalAttributeID = TheShader::Instance()->GetAttribute(mapIndex);
+			m_isLayoutDirty = (m_isLayoutDirty || m_normalAttributeID != attributeID);
+			m_normalAttributeID = attributeID;
 			break;
 		}
 
 		case TEXTURE_BUFFER:
 		{
-			m_textureAttributeID = TheShader::Instance()->GetAttribute(mapIndex);
+			m_isLayoutDirty = (m_isLayoutDirty || m_textureAttributeID != attributeID);
+			m_textureAttributeID = attributeID;
 			break;
 		}
 
@@ -149,35 +268,53 @@ void Buffer::SetComponentSize(BufferType bufferType, ComponentSize componentSize
 
 	//based on which type of component needs to be assigned, 
 	//assign the correct one using the value passed
+	//the VAO only needs to be set up again if the size has changed
 	switch (bufferType)
 	{
 
 		case VERTEX_BUFFER:
 		{
+			m_isLayoutDirty = (m_isLayoutDirty || m_vertexComponentSize != componentSize);
 			m_vertexComponentSize = componentSize;
 			break;
 		}
 
 		case COLOR_BUFFER:
 		{
+			m_isLayoutDirty = (m_isLayoutDirty || m_colorComponentSize != componentSize);
 			m_colorComponentSize = componentSize;
 			break;
 		}
 
 		case NORMAL_BUFFER:
 		{
+			m_isLayoutDirty = (m_isLayoutDirty || m_normalComponentSize != componentSize);
 			m_normalComponentSize = componentSize;
 			break;
 		}
 
 		case TEXTURE_BUFFER:
 		{
+			m_isLayoutDirty = (m_isLayoutDirty || m_textureComponentSize != componentSize);
 			m_textureComponentSize = componentSize;
 			break;
 		}
 
 	}
 
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns per-instance matrix and color shader attribute IDs
+//------------------------------------------------------------------------------------------------------
+void Buffer::SetInstanceAttributeID(const std::string& matrixAttr, const std::string& colorAttr)
+{
+
+	//the VAO needs to be set up again to link the new attributes
+	m_isLayoutDirty = true;
+
+	m_instanceMatrixAttributeID = TheShader::Instance()->GetAttribute(matrixAttr);
+	m_instanceColorAttributeID = TheShader::Instance()->GetAttribute(colorAttr);
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that adds buffer object's data to the OpenGL VBO 
@@ -185,6 +322,14 @@ void Buffer::SetComponentSize(BufferType bufferType, ComponentSize componentSize
 void Buffer::FillData(BufferType bufferType)
 {
 
+	//interleaved data is built and sent to the VBO the next time it's drawn
+	//so that filling all types of data in a row only fills the VBO once
+	if (m_isInterleaved)
+	{
+		m_isDataDirty = true;
+		return;
+	}
+
 	//based on which type of VBO needs to be filled send 
 	//the Buffer Manager all the data that needs to be added to the VBO 
 	switch (bufferType)
@@ -192,30 +337,40 @@ void Buffer::FillData(BufferType bufferType)
 
 		case VERTEX_BUFFER:
 		{
-			TheBuffer::Instance()->Fill(m_vertexBufferID, m_vertices);
+			TheBuffer::Instance()->Fill(TheBuffer::Instance()->GetBufferID(m_vertexBuffer), m_vertices);
 			break;
 		}
 
 		case COLOR_BUFFER:
 		{
-			TheBuffer::Instance()->Fill(m_colorBufferID, m_colors);
+			TheBuffer::Instance()->Fill(TheBuffer::Instance()->GetBufferID(m_colorBuffer), m_colors);
 			break;
 		}
 
 		case NORMAL_BUFFER:
 		{
-			TheBuffer::Instance()->Fill(m_normalBufferID, m_normals);
+			TheBuffer::Instance()->Fill(TheBuffer::Instance()->GetBufferID(m_normalBuffer), m_normals);
 			break;
 		}
 
 		case TEXTURE_BUFFER:
 		{
-			TheBuffer::Instance()->Fill(m_textureBufferID, m_textures);
+			TheBuffer::Instance()->Fill(TheBuffer::Instance()->GetBufferID(m_textureBuffer), m_textures);
 			break;
 		}
 
 	}
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that flags the per-instance data to be sent to the instance VBO
+//------------------------------------------------------------------------------------------------------
+void Buffer::FillInstanceData()
+{
+
+	//the instance data is sent to the VBO the next time it's drawn
+	m_isInstanceDirty = true;
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that sends all the vertex, color, normal and texture coord buffer data to the shader
@@ -225,21 +380,41 @@ void Buffer::DrawData(DrawMode drawMode)
 
 	//variable to store OpenGL drawing mode 
 	//to be passed to OpenGL during the draw call
-	GLenum mode;
+	GLenum mode = GetMode(drawMode);
 
-	//based on draw mode passed set OpenGL draw mode
-	switch (drawMode)
+	//draw any sprites still waiting in the sprite batch first, 
+	//so that everything appears on screen in the order it was drawn
+	TheSpriteBatch::Instance()->Flush();
+
+	//interleaved buffers only need to bind their VAO, after bringing the 
+	//VBO and VAO up to date if the data or its layout have changed 
+	//streamed data has to be written again once the ring has moved on
+	if (m_isInterleaved)
 	{
-		case LINES:        { mode = GL_LINES; break; }
-		case LINE_LOOP:    { mode = GL_LINE_LOOP; break; }
-		case POINTS:       { mode = GL_POINTS; break; }
-		case TRIANGLES:    { mode = GL_TRIANGLES; break; }
-		case TRIANGLE_FAN: { mode = GL_TRIANGLE_FAN; break; }
+
+		UpdateVertexArray();
+		TheBuffer::Instance()->EnableVertexArray(m_vertexArrayID);
+
+		//indices always start from the buffer's first vertex, wherever that is in the VBO
+		if (m_totalIndices > 0)
+		{
+			glDrawElementsBaseVertex(mode, m_totalIndices, m_indexType, 0, m_firstVertex);
+		}
+
+		else
+		{
+			glDrawArrays(mode, m_firstVertex, m_totalVertices);
+		}
+
+		TheBuffer::Instance()->DisableVertexArray();
+
+		return;
+
 	}
 
 	//enable both VBO and shader attribute associated with vertex data of buffer object
 	//link shader vertex attribute with the VBO buffer data as well
-	TheBuffer::Instance()->Enable(m_vertexBufferID);
+	TheBuffer::Instance()->Enable(TheBuffer::Instance()->GetBufferID(m_vertexBuffer));
 	TheShader::Instance()->EnableAttribute(m_vertexAttributeID);
 	TheShader::Instance()->SetAttribute(m_vertexAttributeID, m_vertexComponentSize);
 	
@@ -248,7 +423,7 @@ void Buffer::DrawData(DrawMode drawMode)
 	//link shader color attribute with the VBO buffer data as well
 	if (m_colors.size() > 0)
 	{
-		TheBuffer::Instance()->Enable(m_colorBufferID);
+		TheBuffer::Instance()->Enable(TheBuffer::Instance()->GetBufferID(m_colorBuffer));
 		TheShader::Instance()->EnableAttribute(m_colorAttributeID);
 		TheShader::Instance()->SetAttribute(m_colorAttributeID, m_colorComponentSize);
 	}
@@ -258,7 +433,7 @@ void Buffer::DrawData(DrawMode drawMode)
 	//link shader normal attribute with the VBO buffer data as well
 	if (m_normals.size() > 0)
 	{
-		TheBuffer::Instance()->Enable(m_normalBufferID);
+		TheBuffer::Instance()->Enable(TheBuffer::Instance()->GetBufferID(m_normalBuffer));
 		TheShader::Instance()->EnableAttribute(m_normalAttributeID);
 		TheShader::Instance()->SetAttribute(m_normalAttributeID, m_normalComponentSize);
 	}
@@ -268,7 +443,7 @@ void Buffer::DrawData(DrawMode drawMode)
 	//link shader texture coordinate attribute with the VBO buffer data as well
 	if (m_textures.size() > 0)
 	{
-		TheBuffer::Instance()->Enable(m_textureBufferID);
+		TheBuffer::Instance()->Enable(TheBuffer::Instance()->GetBufferID(m_textureBuffer));
 		TheShader::Instance()->EnableAttribute(m_textureAttributeID);
 		TheShader::Instance()->SetAttribute(m_textureAttributeID, m_textureComponentSize);
 	}
@@ -286,4 +461,415 @@ void Buffer::DrawData(DrawMode drawMode)
 	//unbind VBO so that there are no left over links
 	TheBuffer::Instance()->Disable();
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that draws all instances of buffer object's data in one draw call
+//------------------------------------------------------------------------------------------------------
+void Buffer::DrawInstancedData(DrawMode drawMode)
+{
+
+	//only interleaved buffers have a VAO to link the instance data with
+	if (!m_isInterleaved)
+	{
+		return;
+	}
+
+	GLenum mode = GetMode(drawMode);
+
+	//draw any sprites still waiting in the sprite batch first, 
+	//so that everything appears on screen in the order it was drawn
+	TheSpriteBatch::Instance()->Flush();
+
+	if (m_isInstanceDirty)
+	{
+		UploadInstanceData();
+	}
+
+	UpdateVertexArray();
+
+	if (m_totalInstances == 0 || m_totalVertices == 0)
+	{
+		return;
+	}
+
+	TheBuffer::Instance()->EnableVertexArray(m_vertexArrayID);
+
+	if (m_totalIndices > 0)
+	{
+		glDrawElementsInstancedBaseVertex(mode, m_totalIndices, m_indexType, 0, 
+			                              m_totalInstances, m_firstVertex);
+	}
+
+	else
+	{
+		glDrawArraysInstanced(mode, m_firstVertex, m_totalVertices, m_totalInstances);
+	}
+
+	TheBuffer::Instance()->DisableVertexArray();
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns OpenGL drawing mode based on draw mode passed
+//------------------------------------------------------------------------------------------------------
+GLenum Buffer::GetMode(DrawMode drawMode)
+{
+
+	switch (drawMode)
+	{
+		case LINES:        return GL_LINES;
+		case LINE_LOOP:    return GL_LINE_LOOP;
+		case POINTS:       return GL_POINTS;
+		case TRIANGLES:    return GL_TRIANGLES;
+		case TRIANGLE_FAN: return GL_TRIANGLE_FAN;
+	}
+
+	return GL_TRIANGLES;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that combines all data into one interleaved vector and uploads it
+//------------------------------------------------------------------------------------------------------
+void Buffer::FillInterleavedData()
+{
+
+	//work out where in each vertex the different types of data are placed
+	//each vertex starts with its position, followed by any data that is present
+	GLint colorOffset = -1;
+	GLint normalOffset = -1;
+	GLint textureOffset = -1;
+	GLsizei stride = m_vertexComponentSize;
+
+	if (m_colors.size() > 0)
+	{
+		colorOffset = stride;
+		stride += m_colorComponentSize;
+	}
+
+	if (m_normals.size() > 0)
+	{
+		normalOffset = stride;
+		stride += m_normalComponentSize;
+	}
+
+	if (m_textures.size() > 0)
+	{
+		textureOffset = stride;
+		stride += m_textureComponentSize;
+	}
+
+	//if the data layout changed, the VAO needs to be set up again
+	if (stride != m_stride || colorOffset != m_colorOffset ||
+		normalOffset != m_normalOffset || textureOffset != m_textureOffset)
+	{
+		m_stride = stride;
+		m_colorOffset = colorOffset;
+		m_normalOffset = normalOffset;
+		m_textureOffset = textureOffset;
+		m_isLayoutDirty = true;
+	}
+
+	m_totalVertices = m_vertices.size() / m_vertexComponentSize;
+	m_totalIndices = 0;
+	m_isDataDirty = false;
+
+	//there is nothing to send to the VBO if there are no vertices
+	if (m_totalVertices == 0)
+	{
+		return;
+	}
+
+	//add the data of each vertex one after the other, 
+	//reusing the vector's memory from the previous fill
+	m_interleavedData.clear();
+	m_interleavedData.reserve(m_totalVertices * stride);
+
+	for (int i = 0; i < m_totalVertices; i++)
+	{
+
+		m_interleavedData.insert(m_interleavedData.end(), 
+			                     m_vertices.begin() + i * m_vertexComponentSize,
+			                     m_vertices.begin() + (i + 1) * m_vertexComponentSize);
+
+		if (colorOffset != -1)
+		{
+			m_interleavedData.insert(m_interleavedData.end(), 
+				                     m_colors.begin() + i * m_colorComponentSize,
+				                     m_colors.begin() + (i + 1) * m_colorComponentSize);
+		}
+
+		if (normalOffset != -1)
+		{
+			m_interleavedData.insert(m_interleavedData.end(), 
+				                     m_normals.begin() + i * m_normalComponentSize,
+				                     m_normals.begin() + (i + 1) * m_normalComponentSize);
+		}
+
+		if (textureOffset != -1)
+		{
+			m_interleavedData.insert(m_interleavedData.end(), 
+				                     m_textures.begin() + i * m_textureComponentSize,
+				                     m_textures.begin() + (i + 1) * m_textureComponentSize);
+		}
+
+	}
+
+	FillIndexData();
+	UploadInterleavedData();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that sends the indices to the index VBO, using 16-bit indices if possible
+//------------------------------------------------------------------------------------------------------
+void Buffer::FillIndexData()
+{
+
+	m_totalIndices = m_indices.size();
+
+	if (m_totalIndices == 0)
+	{
+		return;
+	}
+
+	//the buffer creates its own index VBO and VAO the first time it is filled
+	if (!m_indexBufferID)
+	{
+		m_indexBufferID = TheBuffer::Instance()->CreateBuffer();
+	}
+
+	if (!m_vertexArrayID)
+	{
+		m_vertexArrayID = TheBuffer::Instance()->CreateVertexArray();
+	}
+
+	//the index VBO is remembered by whichever VAO is bound while filling it
+	TheBuffer::Instance()->EnableVertexArray(m_vertexArrayID);
+
+	//all vertices can be reached with 16-bit indices, which are half the size
+	if (m_totalVertices <= 65536)
+	{
+		std::vector<GLushort> shortIndices(m_indices.begin(), m_indices.end());
+		TheBuffer::Instance()->FillIndices(m_indexBufferID, shortIndices);
+		m_indexType = GL_UNSIGNED_SHORT;
+	}
+
+	else
+	{
+		TheBuffer::Instance()->FillIndices(m_indexBufferID, m_indices);
+		m_indexType = GL_UNSIGNED_INT;
+	}
+
+	TheBuffer::Instance()->DisableVertexArray();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that sends the interleaved data either to the streaming ring buffer or to the own VBO
+//------------------------------------------------------------------------------------------------------
+void Buffer::UploadInterleavedData()
+{
+
+	GLuint bufferID = 0;
+	m_firstVertex = 0;
+
+	if (m_totalVertices == 0)
+	{
+		return;
+	}
+
+	//write data into the ring, which always starts it on a whole vertex 
+	//so that the draw call can simply begin with the vertex it starts at 
+	if (m_isStreamed)
+	{
+
+		GLsizeiptr stride = m_stride * sizeof(GLfloat);
+		GLint offset = TheStreamBuffer::Instance()->Write(m_interleavedData, stride);
+
+		if (offset != -1)
+		{
+			bufferID = TheStreamBuffer::Instance()->GetBufferID();
+			m_firstVertex = offset / stride;
+			m_streamFrame = TheStreamBuffer::Instance()->GetFrame();
+		}
+
+	}
+
+	//if the data is not streamed or the ring is full use the own VBO, 
+	//which the buffer creates the first time it is filled
+	if (!bufferID)
+	{
+
+		if (!m_interleavedBufferID)
+		{
+			m_interleavedBufferID = TheBuffer::Instance()->CreateBuffer();
+		}
+
+		TheBuffer::Instance()->Fill(m_interleavedBufferID, m_interleavedData);
+		TheBuffer::Instance()->Disable();
+
+		bufferID = m_interleavedBufferID;
+
+	}
+
+	//the VAO has to be linked to the other VBO when switching between them
+	if (bufferID != m_vertexArrayBufferID)
+	{
+		m_vertexArrayBufferID = bufferID;
+		m_isLayoutDirty = true;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that sends the per-instance data to the instance VBO
+//------------------------------------------------------------------------------------------------------
+void Buffer::UploadInstanceData()
+{
+
+	m_totalInstances = m_instances.size() / INSTANCE_SIZE;
+	m_isInstanceDirty = false;
+
+	if (m_totalInstances == 0)
+	{
+		return;
+	}
+
+	//the buffer creates its own instance VBO the first time it is filled
+	//and the VAO needs to be set up again to link the instance attributes to it
+	if (!m_instanceBufferID)
+	{
+		m_instanceBufferID = TheBuffer::Instance()->CreateBuffer();
+		m_isLayoutDirty = true;
+	}
+
+	TheBuffer::Instance()->Fill(m_instanceBufferID, m_instances);
+	TheBuffer::Instance()->Disable();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that brings the VBO and VAO up to date if the data or its layout have changed
+//------------------------------------------------------------------------------------------------------
+void Buffer::UpdateVertexArray()
+{
+
+	//streamed data has to be written again once the ring has moved on
+	if (m_isDataDirty)
+	{
+		FillInterleavedData();
+	}
+
+	else if (m_isStreamed && m_streamFrame != TheStreamBuffer::Instance()->GetFrame())
+	{
+		UploadInterleavedData();
+	}
+
+	if (m_isLayoutDirty)
+	{
+		SetupVertexArray();
+	}
+
+	//make sure OpenGL has all the data written to the ring before it is drawn
+	if (m_isStreamed)
+	{
+		TheStreamBuffer::Instance()->Upload();
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that links all shader attributes with the interleaved VBO and stores that in the VAO
+//------------------------------------------------------------------------------------------------------
+void Buffer::SetupVertexArray()
+{
+
+	//the buffer creates its own VAO the first time it is set up
+	if (!m_vertexArrayID)
+	{
+		m_vertexArrayID = TheBuffer::Instance()->CreateVertexArray();
+	}
+
+	//all attribute links made while the VAO is bound are stored in the VAO
+	TheBuffer::Instance()->EnableVertexArray(m_vertexArrayID);
+	TheBuffer::Instance()->Enable(m_vertexArrayBufferID);
+
+	//stride and offsets are passed to OpenGL in bytes
+	//attributes without any data are switched off in the VAO
+	//and attributes the shader does not use are not linked at all
+	GLsizei stride = m_stride * sizeof(GLfloat);
+
+	if (m_vertexAttributeID != -1)
+	{
+		TheShader::Instance()->EnableAttribute(m_vertexAttributeID);
+		TheShader::Instance()->SetAttribute(m_vertexAttributeID, m_vertexComponentSize, stride, 0);
+	}
+
+	if (m_colorOffset != -1 && m_colorAttributeID != -1)
+	{
+		TheShader::Instance()->EnableAttribute(m_colorAttributeID);
+		TheShader::Instance()->SetAttribute(m_colorAttributeID, m_colorComponentSize, 
+			                                stride, m_colorOffset * sizeof(GLfloat));
+	}
+
+	else
+	{
+		TheShader::Instance()->DisableAttribute(m_colorAttributeID);
+	}
+
+	if (m_normalOffset != -1 && m_normalAttributeID != -1)
+	{
+		TheShader::Instance()->EnableAttribute(m_normalAttributeID);
+		TheShader::Instance()->SetAttribute(m_normalAttributeID, m_normalComponentSize, 
+			                                stride, m_normalOffset * sizeof(GLfloat));
+	}
+
+	else
+	{
+		TheShader::Instance()->DisableAttribute(m_normalAttributeID);
+	}
+
+	if (m_textureOffset != -1 && m_textureAttributeID != -1)
+	{
+		TheShader::Instance()->EnableAttribute(m_textureAttributeID);
+		TheShader::Instance()->SetAttribute(m_textureAttributeID, m_textureComponentSize, 
+			                                stride, m_textureOffset * sizeof(GLfloat));
+	}
+
+	else
+	{
+		TheShader::Instance()->DisableAttribute(m_textureAttributeID);
+	}
+
+	//the per-instance matrix is linked one column at a time, and both 
+	//instance attributes only move on to the next instance's data once 
+	//all vertices of the current instance have been drawn
+	if (m_instanceBufferID)
+	{
+
+		TheBuffer::Instance()->Enable(m_instanceBufferID);
+		GLsizei instanceStride = INSTANCE_SIZE * sizeof(GLfloat);
+
+		if (m_instanceMatrixAttributeID != -1)
+		{
+
+			for (int i = 0; i < 4; i++)
+			{
+				TheShader::Instance()->EnableAttribute(m_instanceMatrixAttributeID + i);
+				TheShader::Instance()->SetAttribute(m_instanceMatrixAttributeID + i, 4,
+					                                instanceStride, i * 4 * sizeof(GLfloat));
+				TheShader::Instance()->SetAttributeDivisor(m_instanceMatrixAttributeID + i, 1);
+			}
+
+		}
+
+		if (m_instanceColorAttributeID != -1)
+		{
+			TheShader::Instance()->EnableAttribute(m_instanceColorAttributeID);
+			TheShader::Instance()->SetAttribute(m_instanceColorAttributeID, 4,
+				                                instanceStride, 16 * sizeof(GLfloat));
+			TheShader::Instance()->SetAttributeDivisor(m_instanceColorAttributeID, 1);
+		}
+
+	}
+
+	TheBuffer::Instance()->DisableVertexArray();
+	TheBuffer::Instance()->Disable();
+
+	m_isLayoutDirty = false;
+
 }
\ No newline at end of file
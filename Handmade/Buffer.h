@@ -28,9 +28,11 @@
   containers that contain all the vertex, color, normal and texture coordinate data. This makes
   accessing and assigning the containers easier in the calling client code.
 
-- The SetBufferID() and SetAttributeID() routines are used to assign the OpenGL VBO buffer IDs and
-  shader attribute IDs respectively to the buffer object. These IDs are requested from the Buffer
-  and Shader Manager respectively. The SetComponentSize() routine is there to set the vertex, 
+- The SetBufferID() and SetAttributeID() routines are used to assign the OpenGL VBO handles and
+  shader attribute IDs respectively to the buffer object. These are requested from the Buffer
+  and Shader Manager respectively, although attribute IDs can also be assigned directly. The VBO 
+  handles are turned into OpenGL IDs each time they are used, so a VBO that has been destroyed 
+  since is never used by mistake. The SetComponentSize() routine is there to set the vertex, 
   color, normal and texture coordinate data component size before sending data to the shader. For
   instance a vertex component could comprise of X and Y for 2D or X, Y and Z for 3D. Colors can be 
   RGB or RGBA. Using the ComponentSize enum type the component types have already been setup for 
@@ -38,7 +40,41 @@
 
 - The FillData() routine will fill the relevant VBOs with data via the Buffer Manager, and the
   DrawData() function enable the vertex, color, normal and texture coordinate OpenGL VBO buffers
-  and shader attributes before using them to send data to the shaders to be rendered. 
+  and shader attributes before using them to send data to the shaders to be rendered. Before
+  drawing, any sprites still waiting in the sprite batch are drawn first, to keep the draw order.
+
+- When the interleaved flag is set, the buffer ignores the VBO IDs assigned and instead creates its
+  own single VBO, in which the data of each vertex is stored next to each other, ie the position, 
+  color, normal and texture coordinate of the first vertex, followed by those of the second vertex,
+  etc. This way the graphics card reads all data of a vertex in one go. The buffer also creates its
+  own vertex array object (VAO), which remembers how the shader attributes are linked to the data,
+  so that drawing becomes one VAO bind and one draw call, instead of binding each VBO and linking
+  each attribute all over again. The FillData() routine then only flags the data as changed, and 
+  the interleaved data is built and sent to the VBO once, the next time the buffer is drawn. The 
+  VAO is only set up again when the shader attributes, component sizes or type of data present 
+  change. Buffers cannot be copied, because each buffer owns its own VBO and VAO.
+
+- Interleaved buffers may also be given a list of indices, in which case each index refers to one
+  vertex and the vertices are drawn in the order of the indices, so that vertices shared by many
+  triangles only need to be stored and processed once. The indices are sent to a separate index 
+  VBO, which the VAO remembers, along with the rest of the data. When there are no more than 65536
+  vertices, the indices are sent as 16-bit values to halve their size. Indices are ignored by 
+  buffers that are not interleaved.
+
+- When the streamed flag is set as well, the interleaved data is not sent to the buffer's own VBO
+  but written into the shared streaming ring buffer, which is meant for data that changes every 
+  frame, like that of dynamic sprites and text. Because the ring moves on to a new segment each 
+  frame, the data is written again each frame it is drawn, and the draw call starts from wherever
+  in the ring the data ended up. Should the ring be full for the frame, the buffer falls back to 
+  using its own VBO. The VAO is only set up again when switching between the two VBOs.
+
+- Interleaved buffers can also draw many copies, or instances, of their data in one draw call using
+  the DrawInstancedData() routine. Each instance has its own transformation matrix and color, which
+  are stored one instance after the other in the vector returned by the Instances() function, and
+  sent to a separate instance VBO the next time the buffer is drawn after calling FillInstanceData().
+  The shader attributes for the per-instance matrix and color are assigned using the 
+  SetInstanceAttributeID() routine and are linked in the VAO to advance once per instance instead 
+  of once per vertex. The matrix attribute takes up four attribute IDs in a row, one per column.
 
 - The Buffer class makes full use of the Buffer and Shader Manager classes, keeping all raw OpenGL
   code in the manager classes instead of in here. This class is intended to act as a link between 
@@ -54,6 +90,10 @@
 #include <string>
 #include <vector>
 #include <OpenGL.h>
+#include "SlotMap.h"
+
+//amount of floats per instance, a 4x4 transformation matrix followed by an RGBA color
+const int INSTANCE_SIZE = 20;
 
 class Buffer
 {
@@ -67,6 +107,12 @@ public:
 public:
 
 	Buffer();
+	~Buffer();
+
+public :
+
+	bool& IsInterleaved();
+	bool& IsStreamed();
 
 public :
 
@@ -74,29 +120,85 @@ public :
 	std::vector<GLfloat>& Colors();
 	std::vector<GLfloat>& Normals();
 	std::vector<GLfloat>& Textures();
+	std::vector<GLuint>& Indices();
+	std::vector<GLfloat>& Instances();
 
 public:
 
 	void SetBufferID(BufferType bufferType, const std::string& mapIndex);
+	GLint GetAttributeID(BufferType bufferType);
 	void SetAttributeID(BufferType bufferType, const std::string& mapIndex);
+	void SetAttributeID(BufferType bufferType, GLint attributeID);
 	void SetComponentSize(BufferType bufferType, ComponentSize componentSize);
+	void SetInstanceAttributeID(const std::string& matrixAttr, const std::string& colorAttr);
 
 public :
 
 	void FillData(BufferType bufferType);
+	void FillInstanceData();
 	void DrawData(DrawMode drawMode);
+	void DrawInstancedData(DrawMode drawMode);
+
+private:
+
+	Buffer(const Buffer&);
+	Buffer& operator=(const Buffer&);
+
+private:
+
+	GLenum GetMode(DrawMode drawMode);
 
 private:
 
-	GLuint m_vertexBufferID;
-	GLuint m_colorBufferID;
-	GLuint m_normalBufferID;
-	GLuint m_textureBufferID;
+	void FillInterleavedData();
+	void FillIndexData();
+	void UploadInterleavedData();
+	void UploadInstanceData();
+	void UpdateVertexArray();
+	void SetupVertexArray();
+
+private:
+
+	bool m_isInterleaved;
+	bool m_isDataDirty;
+	bool m_isLayoutDirty;
+	bool m_isStreamed;
+	bool m_isInstanceDirty;
+
+	GLuint m_interleavedBufferID;
+	GLuint m_vertexArrayID;
+	GLuint m_vertexArrayBufferID;
+	GLuint m_indexBufferID;
+	GLuint m_instanceBufferID;
+
+	GLint m_firstVertex;
+	unsigned int m_streamFrame;
+
+	GLsizei m_totalVertices;
+	GLsizei m_stride;
+	GLint m_colorOffset;
+	GLint m_normalOffset;
+	GLint m_textureOffset;
+
+	GLenum m_indexType;
+	GLsizei m_totalIndices;
+	GLsizei m_totalInstances;
+
+	std::vector<GLfloat> m_interleavedData;
+	std::vector<GLuint> m_indices;
+	std::vector<GLfloat> m_instances;
+
+	Handle m_vertexBuffer;
+	Handle m_colorBuffer;
+	Handle m_normalBuffer;
+	Handle m_textureBuffer;
 
 	GLint m_vertexAttributeID;
 	GLint m_colorAttributeID;
 	GLint m_normalAttributeID;
 	GLint m_textureAttributeID;
+	GLint m_instanceMatrixAttributeID;
+	GLint m_instanceColorAttributeID;
 
 	std::vector<GLfloat> m_vertices;
 	std::vector<GLfloat> m_colors;
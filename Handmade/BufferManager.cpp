@@ -1,30 +1,42 @@
 #include <iostream>
 #include "BufferManager.h"
+#include "ScreenManager.h"
+#include "StateCache.h"
 
 //------------------------------------------------------------------------------------------------------
-//getter function that returns buffer ID based on VBO map index passed 
+//getter function that returns buffer handle based on VBO type and map index passed 
 //------------------------------------------------------------------------------------------------------
-GLuint BufferManager::GetBufferID(BufferType bufferType, const std::string& mapIndex)
+Handle BufferManager::GetBuffer(BufferType bufferType, const std::string& mapIndex)
 {
 
-	//first check if map index is a valid value
-	//if not return a flag to indicate it's invalid
-	//this prevents invalid map entries being created
+	//an empty map index means no VBO is wanted at all
 	if (mapIndex == "")
 	{
-		return -1;
+		return Handle();
 	}
 
-	//otherwise return buffer ID based on buffer type and map index passed 
-	switch (bufferType)
+	std::map<std::string, Handle>* tempMap = GetHandleMap(bufferType);
+	auto it = tempMap->find(mapIndex);
+
+	//if buffer does not exist, display error message and return a null handle
+	if (it == tempMap->end())
 	{
-		case VERTEX_BUFFER  : return m_vertexBufferIDMap[mapIndex]; break;
-		case COLOR_BUFFER   : return m_colorBufferIDMap[mapIndex]; break;
-		case NORMAL_BUFFER  : return m_normalBufferIDMap[mapIndex]; break;
-		case TEXTURE_BUFFER : return m_textureBufferIDMap[mapIndex]; break;
+		std::cout << "Buffer \"" << mapIndex << "\" does not exist." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return Handle();
 	}
 
-	return -1;
+	return it->second;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns buffer ID based on buffer handle passed or 0 if it is stale
+//------------------------------------------------------------------------------------------------------
+GLuint BufferManager::GetBufferID(Handle buffer)
+{
+
+	GLuint* ID = m_bufferIDs.Get(buffer);
+	return (ID ? *ID : 0);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -33,24 +45,54 @@ GLuint BufferManager::GetBufferID(BufferType bufferType, const std::string& mapI
 void BufferManager::Enable(GLuint bufferID)
 {
 
-	glBindBuffer(GL_ARRAY_BUFFER, bufferID); 
+	TheStateCache::Instance()->BindBuffer(bufferID); 
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that deactivates all buffers by binding buffer to NULL
+//function that deactivates all buffers 
 //------------------------------------------------------------------------------------------------------
 void BufferManager::Disable()
 {
 
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	//the VBO is left bound, because all VBOs are bound through the state cache 
+	//before they are used, so unbinding it would only be a wasted call
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that activates VAO based on vertex array ID passed
+//------------------------------------------------------------------------------------------------------
+void BufferManager::EnableVertexArray(GLuint vertexArrayID)
+{
+
+	TheStateCache::Instance()->BindVertexArray(vertexArrayID);
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that creates a specific VBO and stores the ID in a VBO map
+//function that deactivates all VAOs by binding vertex array to NULL
 //------------------------------------------------------------------------------------------------------
-void BufferManager::Create(BufferType bufferType, const std::string& mapIndex)
+void BufferManager::DisableVertexArray()
 {
 
+	//this is needed so that buffers without a VAO do not change the last VAO used
+	TheStateCache::Instance()->BindVertexArray(0);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates a specific VBO, stores the ID in the slot map and returns its handle
+//------------------------------------------------------------------------------------------------------
+Handle BufferManager::Create(BufferType bufferType, const std::string& mapIndex)
+{
+
+	//there is no OpenGL context to create VBOs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return Handle();
+	}
+
+	//if a VBO already exists under the same name, destroy it first, 
+	//so that any handles still referring to the old VBO become stale
+	Destroy(bufferType, CUSTOM_BUFFER, mapIndex);
+
 	//temp ID that will store generated ID number
 	GLuint ID = 0;
 
@@ -59,14 +101,11 @@ void BufferManager::Create(BufferType bufferType, const std::string& mapIndex)
 	//of creating OpenGL objects uses unsigned int variables
 	glGenBuffers(1, &ID);
 
-	//store VBO ID in specific map based on VBO enum type passed
-	switch (bufferType)
-	{
-		case VERTEX_BUFFER  : m_vertexBufferIDMap[mapIndex] = ID; break;
-		case COLOR_BUFFER   : m_colorBufferIDMap[mapIndex] = ID; break;
-		case NORMAL_BUFFER  : m_normalBufferIDMap[mapIndex] = ID; break;
-		case TEXTURE_BUFFER : m_textureBufferIDMap[mapIndex] = ID; break;
-	}
+	//store VBO ID in slot map and its handle in specific map based on VBO enum type passed
+	Handle buffer = m_bufferIDs.Add(ID);
+	(*GetHandleMap(bufferType))[mapIndex] = buffer;
+
+	return buffer;
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -75,9 +114,63 @@ void BufferManager::Create(BufferType bufferType, const std::string& mapIndex)
 void BufferManager::Fill(GLuint bufferID, std::vector<GLfloat>& data)
 {
 
-	glBindBuffer(GL_ARRAY_BUFFER, bufferID);
+	//there is no OpenGL context to fill VBOs in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	TheStateCache::Instance()->BindBuffer(bufferID);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * data.size(), &data[0], GL_DYNAMIC_DRAW);
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds and fills a VBO with the raw bytes passed, for data that is not all floats
+//------------------------------------------------------------------------------------------------------
+void BufferManager::Fill(GLuint bufferID, const void* data, GLsizeiptr size)
+{
+
+	//there is no OpenGL context to fill VBOs in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	TheStateCache::Instance()->BindBuffer(bufferID);
+	glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds and fills an index VBO with 16-bit indices based on buffer ID and data passed
+//------------------------------------------------------------------------------------------------------
+void BufferManager::FillIndices(GLuint bufferID, std::vector<GLushort>& data)
+{
+
+	//there is no OpenGL context to fill VBOs in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferID);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * data.size(), &data[0], GL_STATIC_DRAW);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds and fills an index VBO with 32-bit indices based on buffer ID and data passed
+//------------------------------------------------------------------------------------------------------
+void BufferManager::FillIndices(GLuint bufferID, std::vector<GLuint>& data)
+{
+
+	//there is no OpenGL context to fill VBOs in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferID);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * data.size(), &data[0], GL_STATIC_DRAW);
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that unloads single or multiple buffers from memory
@@ -85,20 +178,16 @@ void BufferManager::Fill(GLuint bufferID, std::vector<GLfloat>& data)
 void BufferManager::Destroy(BufferType bufferType, RemoveType removeType, const std::string& mapIndex)
 {
 
-	//temp pointer which will reference specific buffer ID map
-	std::map<std::string, GLuint>* tempMap = 0; 
-
-	//assign whichever buffer ID map needs to be removed from 
-	//to temp pointer so that when looping through the map later, 
-	//the pointer is used instead of looping through four different maps
-	switch (bufferType)
+	//there is no OpenGL context to destroy VBOs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
 	{
-		case VERTEX_BUFFER  : tempMap = &m_vertexBufferIDMap; break;
-		case COLOR_BUFFER   : tempMap = &m_colorBufferIDMap; break;
-		case NORMAL_BUFFER  : tempMap = &m_normalBufferIDMap; break;
-		case TEXTURE_BUFFER : tempMap = &m_textureBufferIDMap; break;
+		return;
 	}
 
+	//temp pointer which will reference specific buffer handle map
+	//so that the pointer is used instead of four different maps
+	std::map<std::string, Handle>* tempMap = GetHandleMap(bufferType);
+
 	//loop through entire VBO map in order 
 	//to remove a specific buffer or all buffers
 	for (auto it = tempMap->begin(); it != tempMap->end(); it++)
@@ -106,22 +195,24 @@ void BufferManager::Destroy(BufferType bufferType, RemoveType removeType, const
 
 		//if a flag is passed to remove a specific buffer
 		//check if map index is the buffer that needs to be removed
-		//and remove it from both OpenGL and the map
+		//and remove it from OpenGL, the slot map and the map
 		if (removeType == CUSTOM_BUFFER)
 		{
 			if (it->first == mapIndex)
 			{
-				glDeleteBuffers(1, &(it->second));
+				DestroyBuffer(GetBufferID(it->second));
+				m_bufferIDs.Remove(it->second);
 				tempMap->erase(it);
 				break;
 			}
 		}
 
 		//otherwise if a flag is passed to remove all buffers
-		//remove the buffer from OpenGL
+		//remove the buffer from OpenGL and the slot map
 		else if (removeType == ALL_BUFFERS)
 		{
-			glDeleteBuffers(1, &(it->second));
+			DestroyBuffer(GetBufferID(it->second));
+			m_bufferIDs.Remove(it->second);
 		}
 
 	}
@@ -133,6 +224,91 @@ void BufferManager::Destroy(BufferType bufferType, RemoveType removeType, const
 		tempMap->clear();
 	}
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that returns the handle map of the VBO type passed
+//------------------------------------------------------------------------------------------------------
+std::map<std::string, Handle>* BufferManager::GetHandleMap(BufferType bufferType)
+{
+
+	switch (bufferType)
+	{
+		case VERTEX_BUFFER  : return &m_vertexBufferMap;
+		case COLOR_BUFFER   : return &m_colorBufferMap;
+		case NORMAL_BUFFER  : return &m_normalBufferMap;
+		case TEXTURE_BUFFER : return &m_textureBufferMap;
+	}
+
+	return &m_vertexBufferMap;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates a VBO that is not stored in any map and returns its ID
+//------------------------------------------------------------------------------------------------------
+GLuint BufferManager::CreateBuffer()
+{
+
+	//there is no OpenGL context to create VBOs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return 0;
+	}
+
+	GLuint ID = 0;
+	glGenBuffers(1, &ID);
+
+	return ID;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates a VAO and returns its ID
+//------------------------------------------------------------------------------------------------------
+GLuint BufferManager::CreateVertexArray()
+{
+
+	//there is no OpenGL context to create VAOs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return 0;
+	}
+
+	GLuint ID = 0;
+	glGenVertexArrays(1, &ID);
+
+	return ID;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that unloads a VBO that is not stored in any map from memory
+//------------------------------------------------------------------------------------------------------
+void BufferManager::DestroyBuffer(GLuint bufferID)
+{
+
+	//there is no OpenGL context to destroy VBOs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	glDeleteBuffers(1, &bufferID);
+	TheStateCache::Instance()->ForgetBuffer(bufferID);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that unloads a VAO from memory
+//------------------------------------------------------------------------------------------------------
+void BufferManager::DestroyVertexArray(GLuint vertexArrayID)
+{
+
+	//there is no OpenGL context to destroy VAOs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	glDeleteVertexArrays(1, &vertexArrayID);
+	TheStateCache::Instance()->ForgetVertexArray(vertexArrayID);
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that displays total size of all VBO ID maps
@@ -147,40 +323,40 @@ void BufferManager::Output()
 	std::cout << "------------------------------------" << std::endl;
 	std::cout << "Total size of all VBO maps : " << std::endl;
 	std::cout << "------------------------------------" << std::endl;
-	std::cout << "Size of Vertex Buffer Map  : " << m_vertexBufferIDMap.size() << std::endl;
-	std::cout << "Size of Color Buffer Map   : " << m_colorBufferIDMap.size() << std::endl;
-	std::cout << "Size of Normal Buffer Map  : " << m_normalBufferIDMap.size() << std::endl;
-	std::cout << "Size of Texture Buffer Map : " << m_textureBufferIDMap.size() << std::endl;
+	std::cout << "Size of Vertex Buffer Map  : " << m_vertexBufferMap.size() << std::endl;
+	std::cout << "Size of Color Buffer Map   : " << m_colorBufferMap.size() << std::endl;
+	std::cout << "Size of Normal Buffer Map  : " << m_normalBufferMap.size() << std::endl;
+	std::cout << "Size of Texture Buffer Map : " << m_textureBufferMap.size() << std::endl;
 	std::cout << "------------------------------------" << std::endl;
 
 	//loop through vertex map and display each buffer detailing its OpenGL ID and tag name
-	for (auto it = m_vertexBufferIDMap.begin(); it != m_vertexBufferIDMap.end(); it++)
+	for (auto it = m_vertexBufferMap.begin(); it != m_vertexBufferMap.end(); it++)
 	{
-		std::cout << it->second << " : " << it->first << std::endl;
+		std::cout << GetBufferID(it->second) << " : " << it->first << std::endl;
 	}
 
 	std::cout << "------------------------------------" << std::endl;
 
 	//loop through color map and display each buffer detailing its OpenGL ID and tag name
-	for (auto it = m_colorBufferIDMap.begin(); it != m_colorBufferIDMap.end(); it++)
+	for (auto it = m_colorBufferMap.begin(); it != m_colorBufferMap.end(); it++)
 	{
-		std::cout << it->second << " : " << it->first << std::endl;
+		std::cout << GetBufferID(it->second) << " : " << it->first << std::endl;
 	}
 
 	std::cout << "------------------------------------" << std::endl;
 
 	//loop through normal map and display each buffer detailing its OpenGL ID and tag name
-	for (auto it = m_normalBufferIDMap.begin(); it != m_normalBufferIDMap.end(); it++)
+	for (auto it = m_normalBufferMap.begin(); it != m_normalBufferMap.end(); it++)
 	{
-		std::cout << it->second << " : " << it->first << std::endl;
+		std::cout << GetBufferID(it->second) << " : " << it->first << std::endl;
 	}
 
 	std::cout << "------------------------------------" << std::endl;
 
 	//loop through texture map and display each buffer detailing its OpenGL ID and tag name
-	for (auto it = m_textureBufferIDMap.begin(); it != m_textureBufferIDMap.end(); it++)
+	for (auto it = m_textureBufferMap.begin(); it != m_textureBufferMap.end(); it++)
 	{
-		std::cout << it->second << " : " << it->first << std::endl;
+		std::cout << GetBufferID(it->second) << " : " << it->first << std::endl;
 	}
 
 }
\ No newline at end of file
@@ -11,7 +11,8 @@
   -----------------------------------------------------------------------------------------------
 
 - This class encapsulates a vertex buffer object (VBO) manager which will create buffer objects 
-  and store them as OpenGL integer IDs in various maps, with a string reference to that buffer. 
+  and store them as OpenGL integer IDs in a slot map, with a string reference to that buffer kept
+  in one of various maps. 
   The VBOs are created through OpenGL to produce an ID that is needed to use that buffer. Currently
   four different VBOs are supported which are vertex, color, normal and texture buffers. Each buffer
   type has its own map associated with it. To access a particular VBO inside the map the VBO type 
@@ -24,15 +25,30 @@
   for the programmer to work with one of the four supported VBO types.
 
 - To use this class, a Buffer object needs to be created inside the game client code. Then that 
-  buffer object will be able to link to a specific VBO buffer ID from within the Buffer Manager. 
-  The GetBufferID() function is used to request the OpenGL ID and link the VBO buffer data with the
-  buffer object.
+  buffer object will be able to link to a specific VBO from within the Buffer Manager. The
+  GetBuffer() function is used once to look up the VBO by its type and string reference and returns
+  a handle to it, or a null handle if there is no such VBO. The GetBufferID() function then returns
+  the OpenGL ID from the handle each time the VBO is used, which is a simple array lookup, or 0 if 
+  the VBO has since been destroyed.
 
 - The main routines are designed to create and destroy OpenGL buffer IDs, as well as fill them with
   data. The Fill() function can be called once from the client code, if the buffer will remain 
   unchanged, or multiple times if the buffer data is dynamic. The Enable() and Disable() routines
   activate and de-activate buffers respectively, and this needs to be done before a specific VBO
-  can be used.
+  can be used. All binding is done through the state cache, which skips binding VBOs and VAOs that
+  are already bound, and the Disable() routine leaves the VBO bound, because the next VBO used is 
+  bound over it anyway. The FillIndices() routines fill a VBO with 16 or 32-bit vertex indices instead, which
+  are bound as index data, so this should be done while the VAO that uses them is enabled.
+
+- The CreateBuffer() and CreateVertexArray() functions create a VBO and a vertex array object (VAO)
+  respectively, which are not stored in any map, but are owned by whoever created them, and need to
+  be destroyed by them as well. These are used by Buffer objects that manage their own VBO and VAO. 
+  A VAO remembers which VBO and shader attributes are linked together, so that drawing only needs
+  one call to EnableVertexArray(). The DisableVertexArray() routine needs to be called once done, 
+  so that the VAO is not changed by any other buffers linking their attributes afterwards.
+
+- When the screen runs in headless mode there is no OpenGL context, so no VBOs or VAOs are created,
+  filled or destroyed at all.
 
 - An Output() routine is there for debug purposes only and will print to the console how many VBO
   IDs are currently stored in all the maps, as well as detailing each one.
@@ -47,6 +63,7 @@
 #include <vector>
 #include <OpenGL.h>
 #include "Singleton.h"
+#include "SlotMap.h"
 
 class BufferManager
 {
@@ -62,19 +79,32 @@ public:
 
 public :
 
-	GLuint GetBufferID(BufferType bufferType, const std::string& mapIndex);
+	Handle GetBuffer(BufferType bufferType, const std::string& mapIndex);
+	GLuint GetBufferID(Handle buffer);
 	
 public :
 
 	void Enable(GLuint bufferID);
 	void Disable();
+	void EnableVertexArray(GLuint vertexArrayID);
+	void DisableVertexArray();
 
 public:
 
-	void Create(BufferType bufferType, const std::string& mapIndex);
+	Handle Create(BufferType bufferType, const std::string& mapIndex);
 	void Fill(GLuint bufferID, std::vector<GLfloat>& data);
+	void Fill(GLuint bufferID, const void* data, GLsizeiptr size);
+	void FillIndices(GLuint bufferID, std::vector<GLushort>& data);
+	void FillIndices(GLuint bufferID, std::vector<GLuint>& data);
 	void Destroy(BufferType bufferType, RemoveType removeType, const std::string& mapIndex = "");
 
+public:
+
+	GLuint CreateBuffer();
+	GLuint CreateVertexArray();
+	void DestroyBuffer(GLuint bufferID);
+	void DestroyVertexArray(GLuint vertexArrayID);
+
 public:
 
 	void Output();
@@ -87,10 +117,16 @@ private:
 
 private:
 
-	std::map<std::string, GLuint> m_vertexBufferIDMap;
-	std::map<std::string, GLuint> m_colorBufferIDMap;
-	std::map<std::string, GLuint> m_normalBufferIDMap;
-	std::map<std::string, GLuint> m_textureBufferIDMap;
+	std::map<std::string, Handle>* GetHandleMap(BufferType bufferType);
+
+private:
+
+	SlotMap<GLuint> m_bufferIDs;
+
+	std::map<std::string, Handle> m_vertexBufferMap;
+	std::map<std::string, Handle> m_colorBufferMap;
+	std::map<std::string, Handle> m_normalBufferMap;
+	std::map<std::string, Handle> m_textureBufferMap;
 
 };
 
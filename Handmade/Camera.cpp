@@ -46,6 +46,28 @@ Vector3D<double> Camera::GetLookAtDirection()
 
 	return m_lookAtDirection;
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the camera's rotation and positioning as a view matrix
+//------------------------------------------------------------------------------------------------------
+Matrix4D Camera::GetViewMatrix()
+{
+
+	//translation variable to move the world into position
+	Transform translation;
+
+	//start with the camera's total rotation quaternion
+	//here we apply the normal quaternion rotations to the world
+	Matrix4D viewMatrix = m_totalRotation.GetMatrix();
+
+	//move the world in the opposite direction because the world "moves around the camera"
+	translation.Translate((float)-m_position.X, (float)-m_position.Y, (float)-m_position.Z);
+
+	//apply translation transformation to view matrix
+	viewMatrix * translation.GetMatrix();
+
+	return viewMatrix;
+
 }
 //------------------------------------------------------------------------------------------------------
 //setter function that assigns speed of camera
@@ -112,18 +134,11 @@ void Camera::Update()
 void Camera::Draw()
 {
 
-	//translation variable to move the world into position
-	Transform translation;
-
-	//multiply modelview matrix by camera's total rotation quaternion
-	//here we apply the normal quaternion rotations to the world
-	TheScreen::Instance()->ModelViewMatrix() * m_totalRotation.GetMatrix();
-	
-	//move the world in the opposite direction because the world "moves around the camera"
-	translation.Translate((float)-m_position.X, (float)-m_position.Y, (float)-m_position.Z);
+	//calculate the camera's view of the world
+	Matrix4D viewMatrix = GetViewMatrix();
 
-	//apply translation transformation to modelview matrix
-	TheScreen::Instance()->ModelViewMatrix() * translation.GetMatrix();
+	//apply camera rotation and translation transformations to modelview matrix
+	TheScreen::Instance()->ModelViewMatrix() * viewMatrix;
 	
 }
 //------------------------------------------------------------------------------------------------------
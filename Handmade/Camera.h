@@ -45,7 +45,8 @@
   the Update() function the camera's movement vectors are transformed using the camera quaternion's
   inverse rotations, while the Draw() routine applies the regular quaternion rotations to the world.
   This is because the way the camera views the world is opposite to the way the world around it is
-  transformed.
+  transformed. The GetViewMatrix() routine returns the same view that Draw() applies, without
+  touching the modelview matrix, so that it may be calculated away from the main thread.
 
 - The movement functions all set the movement vectors for the camera which are later transformed
   by the internal quaternion so that the camera actually moves in the right direction based on
@@ -74,6 +75,7 @@ public:
 	bool& IsFreeFlow();
 	Vector3D<double>& Position();
 	Vector3D<double>  GetLookAtDirection();
+	Matrix4D GetViewMatrix();
 
 public:
 
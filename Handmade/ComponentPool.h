@@ -0,0 +1,200 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This is a templatized class that stores all components of one type for the entity store, using 
+  what is called a sparse set. All components are packed one after the other in a dense vector, 
+  together with a second dense vector holding the entity each component belongs to. A third sparse
+  vector is indexed by entity and holds the position of that entity's component in the dense 
+  vectors, or -1 if the entity has no such component. This makes adding, finding and removing a 
+  component a matter of a few array lookups, while looping over all components runs through 
+  memory in a straight line without chasing any pointers.
+
+- The Remove() function keeps the dense vectors packed by moving the last component into the hole
+  left behind, so the order of components will change when components are removed. Pointers and 
+  references to components become invalid as soon as components are added or removed.
+
+- The abstract base class allows the entity store to keep pools of all types in one container and 
+  remove an entity's components without knowing their type. Entities are passed as indices here, 
+  as checking if an entity is still alive is left to the entity store.
+
+*/
+
+#ifndef COMPONENT_POOL_H
+#define COMPONENT_POOL_H
+
+#include <vector>
+
+//an entity is a plain number, the lower bits of which hold its 
+//index and the upper bits how many times that index was reused
+typedef unsigned int Entity;
+
+const unsigned int ENTITY_INDEX_BITS = 20;
+const unsigned int ENTITY_INDEX_MASK = (1 << ENTITY_INDEX_BITS) - 1;
+
+//the highest index is never handed out, so that this value never counts as alive
+const Entity NO_ENTITY = 0xFFFFFFFF;
+
+class ComponentPoolBase
+{
+
+public:
+
+	virtual ~ComponentPoolBase() {}
+
+public:
+
+	virtual bool Has(unsigned int index) const = 0;
+	virtual void Remove(unsigned int index)    = 0;
+	virtual void Clear()                       = 0;
+
+};
+
+template <class T> class ComponentPool : public ComponentPoolBase
+{
+
+public:
+
+	int GetSize() const;
+	Entity* GetEntities();
+	T* GetComponents();
+
+public:
+
+	T& Add(Entity entity, unsigned int index, const T& component);
+	T& Get(unsigned int index);
+
+public:
+
+	virtual bool Has(unsigned int index) const;
+	virtual void Remove(unsigned int index);
+	virtual void Clear();
+
+private:
+
+	std::vector<int> m_sparse;
+	std::vector<Entity> m_entities;
+	std::vector<T> m_components;
+
+};
+
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of components in pool
+//------------------------------------------------------------------------------------------------------
+template <class T> int ComponentPool<T>::GetSize() const
+{
+
+	return m_components.size();
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns address of packed entity array
+//------------------------------------------------------------------------------------------------------
+template <class T> Entity* ComponentPool<T>::GetEntities()
+{
+
+	return m_entities.data();
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns address of packed component array
+//------------------------------------------------------------------------------------------------------
+template <class T> T* ComponentPool<T>::GetComponents()
+{
+
+	return m_components.data();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that adds a component for the entity passed or overwrites the one already there
+//------------------------------------------------------------------------------------------------------
+template <class T> T& ComponentPool<T>::Add(Entity entity, unsigned int index, const T& component)
+{
+
+	//if entity already has a component, simply overwrite it
+	if (Has(index))
+	{
+		m_components[m_sparse[index]] = component;
+		return m_components[m_sparse[index]];
+	}
+
+	//make sure the sparse vector is big enough to hold the entity
+	if (index >= m_sparse.size())
+	{
+		m_sparse.resize(index + 1, -1);
+	}
+
+	//add component to the back of the dense vectors
+	m_sparse[index] = m_components.size();
+	m_entities.push_back(entity);
+	m_components.push_back(component);
+
+	return m_components.back();
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns component of the entity passed
+//------------------------------------------------------------------------------------------------------
+template <class T> T& ComponentPool<T>::Get(unsigned int index)
+{
+
+	return m_components[m_sparse[index]];
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if the entity passed has a component in the pool
+//------------------------------------------------------------------------------------------------------
+template <class T> bool ComponentPool<T>::Has(unsigned int index) const
+{
+
+	return (index < m_sparse.size() && m_sparse[index] != -1);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes component of the entity passed by moving the last component in its place
+//------------------------------------------------------------------------------------------------------
+template <class T> void ComponentPool<T>::Remove(unsigned int index)
+{
+
+	if (!Has(index))
+	{
+		return;
+	}
+
+	int denseIndex = m_sparse[index];
+	int lastIndex = m_components.size() - 1;
+
+	//move last component into the hole and point its entity to the new position
+	if (denseIndex != lastIndex)
+	{
+		m_components[denseIndex] = m_components[lastIndex];
+		m_entities[denseIndex] = m_entities[lastIndex];
+		m_sparse[m_entities[denseIndex] & ENTITY_INDEX_MASK] = denseIndex;
+	}
+
+	m_components.pop_back();
+	m_entities.pop_back();
+	m_sparse[index] = -1;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes all components from the pool
+//------------------------------------------------------------------------------------------------------
+template <class T> void ComponentPool<T>::Clear()
+{
+
+	m_sparse.clear();
+	m_entities.clear();
+	m_components.clear();
+
+}
+
+#endif
\ No newline at end of file
@@ -15,27 +15,8 @@
 bool DebugManager::Enable()
 {
 
-	//attach both shaders to the main shader program
-	TheShader::Instance()->Attach(ShaderManager::VERTEX_SHADER, "DEBUG_VERTEX_SHADER");
-	TheShader::Instance()->Attach(ShaderManager::FRAGMENT_SHADER, "DEBUG_FRAGMENT_SHADER");
-
-	//link debug shader program
-	if (!TheShader::Instance()->Link())
-	{
-		return false;
-	}
-
-	return true;
-
-}
-//------------------------------------------------------------------------------------------------------
-//function that de-activates Debug Manager shaders for alternative rendering
-//------------------------------------------------------------------------------------------------------
-void DebugManager::Disable()
-{
-
-	TheShader::Instance()->Detach(ShaderManager::VERTEX_SHADER, "DEBUG_VERTEX_SHADER");
-	TheShader::Instance()->Detach(ShaderManager::FRAGMENT_SHADER, "DEBUG_FRAGMENT_SHADER");
+	//switch to the debug shader program
+	return TheShader::Instance()->UseProgram("DEBUG_PROGRAM");
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -56,20 +37,28 @@ bool DebugManager::Initialize()
 		return false;
 	}
 
-	//compile debug vertex shader file and return false if compilation failed
-	if (!(TheShader::Instance()->
-		  Compile(ShaderManager::VERTEX_SHADER, "Shaders\\Debug.vert", "DEBUG_VERTEX_SHADER")))
+	//compile debug vertex shader file, which is the main shader 
+	//without textures, and return false if compilation failed
+	if (!(TheShader::Instance()->Compile(ShaderManager::VERTEX_SHADER, "Shaders\\Main.vert", 
+		                                 "DEBUG_VERTEX_SHADER", ShaderManager::VERTEX_COLOR)))
 	{
 		return false;
 	}
 
 	//compile debug fragment shader file and return false if compilation failed
-	if (!(TheShader::Instance()->
-		  Compile(ShaderManager::FRAGMENT_SHADER, "Shaders\\Debug.frag", "DEBUG_FRAGMENT_SHADER")))
+	if (!(TheShader::Instance()->Compile(ShaderManager::FRAGMENT_SHADER, "Shaders\\Main.frag", 
+		                                 "DEBUG_FRAGMENT_SHADER", ShaderManager::VERTEX_COLOR)))
 	{
 		return false;
 	}
 	
+	//link both debug shaders into their own program once
+	if (!(TheShader::Instance()->
+		  CreateProgram("DEBUG_PROGRAM", "DEBUG_VERTEX_SHADER", "DEBUG_FRAGMENT_SHADER")))
+	{
+		return false;
+	}
+
 	//activate the debug shaders here before 
 	//they are used below for shader ID links
 	Enable();
@@ -487,10 +476,8 @@ void DebugManager::DrawGrid3D(int size, float lineWidth)
 
 	}
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"), 
-		                              TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"), 
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(), 
 		                              TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//draw grid object using shader
@@ -611,10 +598,8 @@ void DebugManager::DrawGrid2D(int size, float lineWidth, int pixelsPerUnit)
 
 	}
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//draw grid object using shader
@@ -690,10 +675,8 @@ void DebugManager::DrawCoordSystem3D(float size, float lineWidth)
 	m_coordBuffer.Colors().push_back(1.0f); m_coordBuffer.Colors().push_back(0.0f);
 	m_coordBuffer.Colors().push_back(0.0f); m_coordBuffer.Colors().push_back(1.0f);
 	
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//fill VBO with coordinate system vertex and color data
@@ -752,10 +735,8 @@ void DebugManager::DrawCoordSystem2D(float size, float lineWidth, int pixelsPerU
 	m_coordBuffer.Colors().push_back(0.0f); m_coordBuffer.Colors().push_back(0.0f);
 	m_coordBuffer.Colors().push_back(1.0f); m_coordBuffer.Colors().push_back(0.0f);
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//fill VBO with coordinate system vertex and color data
@@ -784,10 +765,8 @@ void DebugManager::DrawCube3D(float width, float height, float depth, Color colo
 	scale.Scale(width, height, depth);
 	TheScreen::Instance()->ModelViewMatrix() * scale.GetMatrix();
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//set color of cube based on color value passed
@@ -872,10 +851,8 @@ void DebugManager::DrawCube2D(float width, float height, Color color, int pixels
 	m_cubeBuffer2D.Colors().push_back(color.R); m_cubeBuffer2D.Colors().push_back(color.G);
 	m_cubeBuffer2D.Colors().push_back(color.B); m_cubeBuffer2D.Colors().push_back(color.A);
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-		                              TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 		                              TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//fill VBO with cube vertex and color data
@@ -904,10 +881,8 @@ void DebugManager::DrawSphere3D(float radius, Color color)
 	scale.Scale(radius, radius, radius);
 	TheScreen::Instance()->ModelViewMatrix() * scale.GetMatrix();
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//set color of sphere based on color value passed
@@ -976,10 +951,8 @@ void DebugManager::DrawSphere2D(float radius, Color color, int slices, int pixel
 
 	}
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//fill VBO with sphere vertex and color data
@@ -1031,10 +1004,8 @@ void DebugManager::DrawVector(float x, float y, float z,
 	m_vectorBuffer.Colors().push_back(color.R); m_vectorBuffer.Colors().push_back(color.G);
 	m_vectorBuffer.Colors().push_back(color.B); m_vectorBuffer.Colors().push_back(color.A);
 	
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-									  TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 									  TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 	
 	//fill VBO with vector vertex and color data
@@ -1077,10 +1048,8 @@ void DebugManager::DrawVertex(float x, float y, float z,
 	m_vertexBuffer.Colors().push_back(color.R); m_vertexBuffer.Colors().push_back(color.G);
 	m_vertexBuffer.Colors().push_back(color.B); m_vertexBuffer.Colors().push_back(color.A);
 	
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-		                              TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 		                              TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//fill VBO with vertex and color data for vertex point
@@ -1132,10 +1101,8 @@ void DebugManager::DrawLine(float x1, float y1, float z1, float x2, float y2, fl
 	m_lineBuffer.Colors().push_back(color.R); m_lineBuffer.Colors().push_back(color.G);
 	m_lineBuffer.Colors().push_back(color.B); m_lineBuffer.Colors().push_back(color.A);
 
-	//send projection and modelview matrix data to shader using shader uniform ID 
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-		                              TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shader using shader uniform ID 
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 		                              TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//fill VBO with vector vertex and color data
@@ -26,9 +26,9 @@
   cube or sphere are scaled up, the texture will be scaled and at very high values will start to
   tear.
 
-- The Enable() and Disable() functions are designed to switch on and off the Debug Manager's
-  own shaders, so that any other external shaders can be used instead. The Debug Manager works
-  with its own shaders.
+- The Enable() function is designed to switch to the Debug Manager's own shader program, which is
+  linked once when the Debug Manager is initialized. Other shader programs can be used in between 
+  simply by switching to them. The Debug Manager works with its own shaders.
 
 - The Initialize() function will compile the debug shaders and set up the VBOs needed for all
   rendering of debug objects. It will also link the buffer objects to their relevant VBOs and 
@@ -99,7 +99,6 @@ public:
 public :
 
 	bool Enable();
-	void Disable();
 
 public :
 
@@ -10,6 +10,15 @@ bool EndState::OnEnter()
 	m_endMessage = new SplashScreen("Sprites\\Credits.jpg");
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that loads the credits image on the loading thread before the state is entered
+//------------------------------------------------------------------------------------------------------
+bool EndState::OnPreload()
+{
+
+	return PreloadTextures({ "Sprites\\Credits.jpg" });
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that updates splash screen object 
@@ -49,14 +58,19 @@ bool EndState::Draw()
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that destroys the main program shaders that were created in the Start State
+//function that destroys the main program and shaders that were created in the Start State
 //------------------------------------------------------------------------------------------------------
 void EndState::OnExit()
 {
 
+	TheShader::Instance()->DestroyProgram("MAIN_PROGRAM");
+	TheShader::Instance()->DestroyProgram("INSTANCED_PROGRAM");
+
 	TheShader::Instance()->
 	Destroy(ShaderManager::VERTEX_SHADER, ShaderManager::CUSTOM_SHADER, "MAIN_VERTEX_SHADER");
 	TheShader::Instance()->
+	Destroy(ShaderManager::VERTEX_SHADER, ShaderManager::CUSTOM_SHADER, "INSTANCED_VERTEX_SHADER");
+	TheShader::Instance()->
 	Destroy(ShaderManager::FRAGMENT_SHADER, ShaderManager::CUSTOM_SHADER, "MAIN_FRAGMENT_SHADER");
 
 }
\ No newline at end of file
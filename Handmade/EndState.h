@@ -35,6 +35,7 @@ public:
 public:
 
 	virtual bool OnEnter();
+	virtual bool OnPreload();
 	virtual bool Update();
 	virtual bool Draw();
 	virtual void OnExit();
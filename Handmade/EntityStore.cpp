@@ -0,0 +1,160 @@
+#include <iostream>
+#include "EntityStore.h"
+
+std::atomic<int> EntityStore::s_totalComponentTypes(0);
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+EntityStore::EntityStore()
+{
+
+	m_totalEntities = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//destructor that destroys all component pools
+//------------------------------------------------------------------------------------------------------
+EntityStore::~EntityStore()
+{
+
+	for (auto it = m_pools.begin(); it != m_pools.end(); it++)
+	{
+		delete (*it);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of entities alive
+//------------------------------------------------------------------------------------------------------
+int EntityStore::GetTotalEntities()
+{
+
+	return m_totalEntities;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates a new entity, reusing the index of a destroyed entity if there is one
+//------------------------------------------------------------------------------------------------------
+Entity EntityStore::CreateEntity()
+{
+
+	unsigned int index = 0;
+
+	if (!m_freeIndices.empty())
+	{
+		index = m_freeIndices.back();
+		m_freeIndices.pop_back();
+	}
+
+	//the index would otherwise run over into the generation bits
+	else if (m_generations.size() >= ENTITY_INDEX_MASK)
+	{
+		std::cout << "Entity store is full, no more entities can be created." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return NO_ENTITY;
+	}
+
+	else
+	{
+		index = m_generations.size();
+		m_generations.push_back(0);
+	}
+
+	m_totalEntities++;
+
+	return (m_generations[index] << ENTITY_INDEX_BITS) | index;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes all components of the entity passed and frees its index for reuse
+//------------------------------------------------------------------------------------------------------
+void EntityStore::DestroyEntity(Entity entity)
+{
+
+	if (!IsAlive(entity))
+	{
+		return;
+	}
+
+	unsigned int index = entity & ENTITY_INDEX_MASK;
+
+	for (auto it = m_pools.begin(); it != m_pools.end(); it++)
+	{
+		if (*it)
+		{
+			(*it)->Remove(index);
+		}
+	}
+
+	//increase the generation so that the old entity value no longer counts as alive
+	m_generations[index] = (m_generations[index] + 1) & (0xFFFFFFFF >> ENTITY_INDEX_BITS);
+	m_freeIndices.push_back(index);
+	m_totalEntities--;
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if the entity passed has not been destroyed
+//------------------------------------------------------------------------------------------------------
+bool EntityStore::IsAlive(Entity entity)
+{
+
+	unsigned int index = entity & ENTITY_INDEX_MASK;
+
+	return (index < m_generations.size() && 
+		    m_generations[index] == (entity >> ENTITY_INDEX_BITS));
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that destroys all entities and their components
+//------------------------------------------------------------------------------------------------------
+void EntityStore::Clear()
+{
+
+	for (auto it = m_pools.begin(); it != m_pools.end(); it++)
+	{
+		if (*it)
+		{
+			(*it)->Clear();
+		}
+	}
+
+	//increase the generation of every index instead of forgetting them, so that
+	//entity values kept from before are not counted as alive once reused
+	m_totalEntities = 0;
+	m_freeIndices.clear();
+
+	for (unsigned int i = m_generations.size(); i > 0; i--)
+	{
+		m_generations[i - 1] = (m_generations[i - 1] + 1) & (0xFFFFFFFF >> ENTITY_INDEX_BITS);
+		m_freeIndices.push_back(i - 1);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that updates all physics components across all worker threads
+//------------------------------------------------------------------------------------------------------
+void EntityStore::UpdatePhysics()
+{
+
+	ParallelForEach<Physics>([](Entity /*entity*/, Physics& physics)
+	{
+		physics.Update();
+	});
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that moves all transform components to their entity's physics position
+//------------------------------------------------------------------------------------------------------
+void EntityStore::UpdateTransforms()
+{
+
+	ParallelForEach<Transform, Physics>([](Entity /*entity*/, Transform& transform, Physics& physics)
+	{
+		transform.GetMatrix() = Matrix4D::IDENTITY;
+		transform.Translate((float)physics.Position().X,
+			                (float)physics.Position().Y,
+			                (float)physics.Position().Z);
+	});
+
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates a data oriented entity-component store, which can be used alongside the
+  game objects for when there are many thousands of simple things to update. An entity is nothing
+  more than a number, and all of its data lives in components, which are plain classes such as the
+  Transform, Physics and bound classes. Each type of component is stored in its own component pool,
+  packed into one array, so that updating all components of one type runs through memory in a 
+  straight line, instead of chasing pointers to game objects scattered all over the heap. Each game 
+  state hosts one entity store.
+
+- The CreateEntity() function hands out a new entity, reusing the indices of destroyed entities. 
+  Each time an index is reused its generation is increased, so that an old entity value that is 
+  still kept somewhere will no longer count as alive. The DestroyEntity() routine removes all of the
+  entity's components from all pools. The Clear() routine destroys all entities in one go, which 
+  also increases the generation of every index. Once all indices are in use, CreateEntity() returns
+  NO_ENTITY, which is never alive and should not be given any components.
+
+- The component functions are templates, so that any class with a default constructor and copy 
+  assignment can be used as a component. Each component type is handed a unique number the first 
+  time it is used, which is the index of its pool in the m_pools vector.
+
+- The ForEach() routine runs the function passed for each entity that has all the component types
+  listed, passing the entity and a reference to each component, for example :
+  ForEach<Physics, Transform>([](Entity entity, Physics& physics, Transform& transform) { ... });
+  The loop runs over the packed pool of the first component type and looks up the others, so the
+  rarest component type should be listed first. No components may be added or removed during the 
+  loop. The ParallelForEach() version splits the loop into chunks that are run by the job manager's
+  worker threads, so the function passed may only access the components of the entity passed.
+
+- The UpdatePhysics(), UpdateTransforms() and UpdateBounds() routines act as adapters that let the
+  existing component classes run as packed components. The first updates all Physics components, 
+  the second moves all Transform components to their entity's physics position, and the third moves
+  all bounds of the type given to their entity's physics position and updates them. All three run
+  in parallel. Rotation is left to the client code, as the physics class only stores an angle.
+
+*/
+
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <atomic>
+#include <vector>
+#include "ComponentPool.h"
+#include "JobManager.h"
+#include "Physics.h"
+#include "Transform.h"
+
+//amount of entities each worker thread processes in one go
+const int ENTITIES_PER_JOB = 1024;
+
+class EntityStore
+{
+
+public:
+
+	EntityStore();
+	~EntityStore();
+
+public:
+
+	int GetTotalEntities();
+
+public:
+
+	Entity CreateEntity();
+	void DestroyEntity(Entity entity);
+	bool IsAlive(Entity entity);
+	void Clear();
+
+public:
+
+	template <class T> T& AddComponent(Entity entity, const T& component = T());
+	template <class T> void RemoveComponent(Entity entity);
+	template <class T> bool HasComponent(Entity entity);
+	template <class T> T& GetComponent(Entity entity);
+	template <class T> ComponentPool<T>& GetPool();
+
+public:
+
+	template <class T, class... Others, class Func> void ForEach(Func func);
+	template <class T, class... Others, class Func> void ParallelForEach(Func func);
+
+public:
+
+	void UpdatePhysics();
+	void UpdateTransforms();
+	template <class T> void UpdateBounds();
+
+private:
+
+	EntityStore(const EntityStore&);
+	EntityStore& operator=(const EntityStore&);
+
+private:
+
+	template <class T> static int GetComponentType();
+	template <class... Others> bool HasComponents(unsigned int index);
+
+private:
+
+	static std::atomic<int> s_totalComponentTypes;
+
+private:
+
+	int m_totalEntities;
+
+	std::vector<unsigned int> m_generations;
+	std::vector<unsigned int> m_freeIndices;
+	std::vector<ComponentPoolBase*> m_pools;
+
+};
+
+//------------------------------------------------------------------------------------------------------
+//function that adds a component to the entity passed and returns a reference to it
+//------------------------------------------------------------------------------------------------------
+template <class T> T& EntityStore::AddComponent(Entity entity, const T& component)
+{
+
+	return GetPool<T>().Add(entity, entity & ENTITY_INDEX_MASK, component);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes a component from the entity passed
+//------------------------------------------------------------------------------------------------------
+template <class T> void EntityStore::RemoveComponent(Entity entity)
+{
+
+	if (IsAlive(entity))
+	{
+		GetPool<T>().Remove(entity & ENTITY_INDEX_MASK);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if the entity passed is alive and has the component
+//------------------------------------------------------------------------------------------------------
+template <class T> bool EntityStore::HasComponent(Entity entity)
+{
+
+	return (IsAlive(entity) && GetPool<T>().Has(entity & ENTITY_INDEX_MASK));
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns component of the entity passed, which must have the component
+//------------------------------------------------------------------------------------------------------
+template <class T> T& EntityStore::GetComponent(Entity entity)
+{
+
+	return GetPool<T>().Get(entity & ENTITY_INDEX_MASK);
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the pool of the component type, creating it the first time
+//------------------------------------------------------------------------------------------------------
+template <class T> ComponentPool<T>& EntityStore::GetPool()
+{
+
+	unsigned int type = GetComponentType<T>();
+
+	if (type >= m_pools.size())
+	{
+		m_pools.resize(type + 1, 0);
+	}
+
+	if (!m_pools[type])
+	{
+		m_pools[type] = new ComponentPool<T>;
+	}
+
+	return *(static_cast<ComponentPool<T>*>(m_pools[type]));
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that runs the function passed for each entity that has all component types listed
+//------------------------------------------------------------------------------------------------------
+template <class T, class... Others, class Func> void EntityStore::ForEach(Func func)
+{
+
+	ComponentPool<T>& pool = GetPool<T>();
+
+	Entity* entities = pool.GetEntities();
+	T* components = pool.GetComponents();
+
+	for (int i = 0; i < pool.GetSize(); i++)
+	{
+
+		unsigned int index = entities[i] & ENTITY_INDEX_MASK;
+
+		if (HasComponents<Others...>(index))
+		{
+			func(entities[i], components[i], GetPool<Others>().Get(index)...);
+		}
+
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that runs the function passed for each matching entity across all worker threads
+//------------------------------------------------------------------------------------------------------
+template <class T, class... Others, class Func> void EntityStore::ParallelForEach(Func func)
+{
+
+	ComponentPool<T>& pool = GetPool<T>();
+
+	//make sure all pools exist before the worker threads look them up
+	int pools[] = { 0, (GetPool<Others>(), 0)... };
+	(void)pools;
+
+	Entity* entities = pool.GetEntities();
+	T* components = pool.GetComponents();
+
+	TheJob::Instance()->ParallelFor(pool.GetSize(), ENTITIES_PER_JOB,
+		                            [this, &func, entities, components](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+
+			unsigned int index = entities[i] & ENTITY_INDEX_MASK;
+
+			if (HasComponents<Others...>(index))
+			{
+				func(entities[i], components[i], GetPool<Others>().Get(index)...);
+			}
+
+		}
+	});
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that moves all bounds of the type given to their entity's physics position
+//------------------------------------------------------------------------------------------------------
+template <class T> void EntityStore::UpdateBounds()
+{
+
+	ParallelForEach<T, Physics>([](Entity /*entity*/, T& bound, Physics& physics)
+	{
+		bound.SetPosition((float)physics.Position().X,
+			              (float)physics.Position().Y,
+			              (float)physics.Position().Z);
+		bound.Update();
+	});
+
+}
+//------------------------------------------------------------------------------------------------------
+//static function that returns the unique number of the component type, assigned on first use
+//------------------------------------------------------------------------------------------------------
+template <class T> int EntityStore::GetComponentType()
+{
+
+	static int s_type = s_totalComponentTypes++;
+	return s_type;
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if the entity passed has all of the component types listed
+//------------------------------------------------------------------------------------------------------
+template <class... Others> bool EntityStore::HasComponents(unsigned int index)
+{
+
+	ComponentPoolBase* pools[] = { nullptr, &GetPool<Others>()... };
+
+	//check each pool in turn, stopping as soon as one is missing
+	for (size_t i = 1; i < sizeof(pools) / sizeof(pools[0]); i++)
+	{
+		if (!pools[i]->Has(index))
+		{
+			return false;
+		}
+	}
+
+	return true;
+
+}
+
+#endif
\ No newline at end of file
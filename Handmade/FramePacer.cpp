@@ -0,0 +1,100 @@
+#include "FramePacer.h"
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+FramePacer::FramePacer()
+{
+
+	m_targetFrameRate = 0;
+
+	m_spinTime = 0.002;
+	m_frameTime = 0.0;
+	m_frameEndTime = 0.0;
+
+	m_frequency = SDL_GetPerformanceFrequency();
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the frame rate the game is limited to
+//------------------------------------------------------------------------------------------------------
+int FramePacer::GetTargetFrameRate()
+{
+
+	return m_targetFrameRate;
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns the frame rate the game is limited to, or 0 for no limit
+//------------------------------------------------------------------------------------------------------
+void FramePacer::SetTargetFrameRate(int frameRate)
+{
+
+	m_targetFrameRate = (frameRate > 0 ? frameRate : 0);
+	m_frameTime = (m_targetFrameRate > 0 ? 1.0 / m_targetFrameRate : 0.0);
+
+	//restart timing using the new frame time
+	Start();
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns how long to spin instead of sleep at the end of each frame
+//------------------------------------------------------------------------------------------------------
+void FramePacer::SetSpinTime(double milliseconds)
+{
+
+	m_spinTime = milliseconds / 1000.0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that sets up the time at which the first frame should end
+//------------------------------------------------------------------------------------------------------
+void FramePacer::Start()
+{
+
+	m_frameEndTime = GetTime() + m_frameTime;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that waits until the current frame should end
+//------------------------------------------------------------------------------------------------------
+void FramePacer::Wait()
+{
+
+	//if the frame rate is not limited there is nothing to wait for
+	if (m_targetFrameRate == 0)
+	{
+		return;
+	}
+
+	double timeLeft = m_frameEndTime - GetTime();
+
+	//if the frame ran late, restart timing from now instead of catching up
+	if (timeLeft <= 0.0)
+	{
+		Start();
+		return;
+	}
+
+	//sleep for most of the time left, leaving enough time to make up for oversleeping
+	if (timeLeft > m_spinTime)
+	{
+		SDL_Delay((Uint32)((timeLeft - m_spinTime) * 1000.0));
+	}
+
+	//spin for the remaining time until the frame should end
+	while (GetTime() < m_frameEndTime) {}
+
+	//the next frame ends one frame time after this one
+	m_frameEndTime += m_frameTime;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the current high precision time in seconds
+//------------------------------------------------------------------------------------------------------
+double FramePacer::GetTime()
+{
+
+	return (double)SDL_GetPerformanceCounter() / m_frequency;
+
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates a frame limiter that keeps the game running at a steady target frame 
+  rate when VSync is switched off. It uses SDL's high precision performance counter instead of the
+  millisecond SDL clock, so that frame times can be measured accurately. A target frame rate of 0
+  means that the frame rate is not limited at all.
+
+- The Start() function sets up the time at which the first frame should end. The Wait() routine
+  is called at the end of each frame and waits until that time has come. Because sleeping is not
+  very precise and may oversleep by a millisecond or more, the thread only sleeps for the bulk of
+  the time left, and then spins for the last bit, set by the spin time. Each frame's end time is 
+  based on the previous one instead of on the current time, so that small errors do not add up. 
+  If a frame runs late the timing simply restarts from that point on, instead of trying to catch
+  up with a few very short frames.
+
+*/
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <SDL.h>
+
+class FramePacer
+{
+
+public:
+
+	FramePacer();
+
+public:
+
+	int GetTargetFrameRate();
+	void SetTargetFrameRate(int frameRate);
+	void SetSpinTime(double milliseconds);
+
+public:
+
+	void Start();
+	void Wait();
+
+private:
+
+	double GetTime();
+
+private:
+
+	int m_targetFrameRate;
+
+	double m_spinTime;
+	double m_frameTime;
+	double m_frameEndTime;
+
+	Uint64 m_frequency;
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "Frustum.h"
+
+//------------------------------------------------------------------------------------------------------
+//setter function that works out the frustum planes from the projection and modelview matrices
+//------------------------------------------------------------------------------------------------------
+void Frustum::SetFrustum(Matrix4D& projection, Matrix4D& modelview)
+{
+
+	//combine both matrices, which are stored in column order
+	//without using the Matrix4D multiplication, which changes the matrix itself
+	float* p = projection.GetMatrixArray();
+	float* m = modelview.GetMatrixArray();
+	float clip[16];
+
+	for (int column = 0; column < 4; column++)
+	{
+		for (int row = 0; row < 4; row++)
+		{
+			clip[column * 4 + row] = p[row]     * m[column * 4]     + p[row + 4]  * m[column * 4 + 1] +
+				                     p[row + 8] * m[column * 4 + 2] + p[row + 12] * m[column * 4 + 3];
+		}
+	}
+
+	//each plane is the fourth row of the combined matrix 
+	//with one of the other three rows added or subtracted
+	for (int i = 0; i < TOTAL_PLANES; i++)
+	{
+
+		int row = i / 2;
+		float sign = (i % 2 == 0 ? 1.0f : -1.0f);
+
+		m_planes[i].X = clip[3]  + sign * clip[row];
+		m_planes[i].Y = clip[7]  + sign * clip[row + 4];
+		m_planes[i].Z = clip[11] + sign * clip[row + 8];
+		m_planes[i].W = clip[15] + sign * clip[row + 12];
+
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if world space box is at least partly inside frustum
+//------------------------------------------------------------------------------------------------------
+bool Frustum::IsBoxVisible(const Vector3D<float>& min, const Vector3D<float>& max) const
+{
+
+	return IsBoxVisible(min, max, TOTAL_PLANES);
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if world space rectangle is at least partly inside frustum
+//------------------------------------------------------------------------------------------------------
+bool Frustum::IsRectangleVisible(const Vector2D<float>& min, const Vector2D<float>& max) const
+{
+
+	//only check the four side planes, because 2D objects all lie on the same flat surface
+	return IsBoxVisible(Vector3D<float>(min.X, min.Y, 0.0f), Vector3D<float>(max.X, max.Y, 0.0f), NEAR_PLANE);
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks world space box against the amount of planes passed
+//------------------------------------------------------------------------------------------------------
+bool Frustum::IsBoxVisible(const Vector3D<float>& min, const Vector3D<float>& max, int totalPlanes) const
+{
+
+	for (int i = 0; i < totalPlanes; i++)
+	{
+
+		//pick the box corner furthest along the direction the plane faces
+		float x = (m_planes[i].X >= 0.0f ? max.X : min.X);
+		float y = (m_planes[i].Y >= 0.0f ? max.Y : min.Y);
+		float z = (m_planes[i].Z >= 0.0f ? max.Z : min.Z);
+
+		//if even that corner is behind the plane the entire box is outside
+		if (m_planes[i].X * x + m_planes[i].Y * y + m_planes[i].Z * z + m_planes[i].W < 0.0f)
+		{
+			return false;
+		}
+
+	}
+
+	return true;
+
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates a view frustum, which is the part of the game world that can be seen on
+  screen. It is made up of six planes, left, right, bottom, top, near and far, which all face into
+  the frustum. Anything that lies completely behind any one of these planes is off screen and need
+  not be drawn at all, which is called culling.
+
+- The SetFrustum() routine works out the six planes from the projection and modelview matrices 
+  passed, by first combining both matrices and then adding or subtracting its first three rows to
+  or from its fourth row. When the modelview matrix only holds the camera view, the planes are in 
+  world space, which is where the bounds are. The planes do not need to be normalized, because the 
+  checks only care about which side of a plane a point is on, not how far away from it.
+
+- The IsBoxVisible() function checks if a world space box is at least partly inside the frustum.
+  For each plane, only the corner of the box that lies furthest along the plane's facing direction
+  is checked, because if that corner is behind the plane, the whole box is. Boxes near the corners 
+  of the frustum may be flagged as visible even though they are not, which is harmless as they are 
+  then simply drawn. The IsRectangleVisible() function is the 2D version, which only checks the left,
+  right, bottom and top planes, so that flat 2D objects are never culled by the near and far planes.
+
+*/
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "Matrix4D.h"
+#include "Vector2D.h"
+#include "Vector3D.h"
+#include "Vector4D.h"
+
+class Frustum
+{
+
+public:
+
+	enum PlaneType { LEFT, RIGHT, BOTTOM, TOP, NEAR_PLANE, FAR_PLANE, TOTAL_PLANES };
+
+public:
+
+	void SetFrustum(Matrix4D& projection, Matrix4D& modelview);
+
+public:
+
+	bool IsBoxVisible(const Vector3D<float>& min, const Vector3D<float>& max) const;
+	bool IsRectangleVisible(const Vector2D<float>& min, const Vector2D<float>& max) const;
+
+private:
+
+	bool IsBoxVisible(const Vector3D<float>& min, const Vector3D<float>& max, int totalPlanes) const;
+
+private:
+
+	Vector4D<float> m_planes[TOTAL_PLANES];
+
+};
+
+#endif
\ No newline at end of file
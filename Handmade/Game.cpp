@@ -1,9 +1,16 @@
+#include <atomic>
+#include <iostream>
 #include "AudioManager.h"
 #include "DebugManager.h"
 #include "Game.h"
 #include "InputManager.h"
+#include "JobManager.h"
+#include "SceneNode.h"
 #include "ShaderManager.h"
+#include "StateCache.h"
 #include "ScreenManager.h"
+#include "SpriteBatch.h"
+#include "StreamBuffer.h"
 #include "TimeManager.h"
 
 //------------------------------------------------------------------------------------------------------
@@ -12,7 +19,20 @@
 Game::Game()
 {
 
+	m_isPipelined = false;
+	m_isFixedTimeStep = false;
+
+	m_maxSteps = 5;
+	m_timeStep = 1.0 / 60.0;
+	m_frameTime = 0.0;
+	m_accumulator = 0.0;
+	m_interpolation = 1.0f;
+
+	m_isPreloaded = false;
+	m_isPreloadSuccessful = true;
+
 	m_activeGameState = 0;
+	m_preloadGameState = 0;
 	m_gameStateManager.reserve(5);
 
 }
@@ -42,29 +62,132 @@ void Game::RemoveGameState(int index)
 
 	m_gameStateManager.erase(m_gameStateManager.begin() + index);
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns flag stating if the next state has finished preloading
+//------------------------------------------------------------------------------------------------------
+bool Game::IsReady()
+{
+
+	return m_isPreloaded;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the loading progress of the state being preloaded
+//------------------------------------------------------------------------------------------------------
+float Game::GetLoadProgress()
+{
+
+	return (m_preloadGameState ? m_preloadGameState->GetLoadProgress() : 0.0f);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that starts preloading the next game state on a separate loading thread
+//------------------------------------------------------------------------------------------------------
+bool Game::PreloadNext()
+{
+
+	//the next state is the one before the active state at the back of the vector
+	//there is nothing to preload if there is no next state or if it is already preloading
+	if (m_gameStateManager.size() < 2 || m_preloadGameState)
+	{
+		return false;
+	}
+
+	m_isPreloaded = false;
+	m_preloadGameState = *(m_gameStateManager.end() - 2);
+	m_preloadGameState->SetLoadProgress(0.0f);
+
+	//load all of the next state's resource files on the loading thread
+	m_preloadThread = std::thread([this]()
+	{
+		m_isPreloadSuccessful = m_preloadGameState->OnPreload();
+		m_preloadGameState->SetLoadProgress(1.0f);
+		m_isPreloaded = true;
+	});
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter-setter function that returns pipelined frame flag reference
+//------------------------------------------------------------------------------------------------------
+bool& Game::IsPipelined()
+{
+
+	return m_isPipelined;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter-setter function that returns fixed time step flag reference
+//------------------------------------------------------------------------------------------------------
+bool& Game::IsFixedTimeStep()
+{
+
+	return m_isFixedTimeStep;
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns the fixed update rate and the maximum catch-up steps per frame
+//------------------------------------------------------------------------------------------------------
+void Game::SetTickRate(int tickRate, int maxSteps)
+{
+
+	//make sure there is always at least one update per second and per frame
+	m_timeStep = 1.0 / (tickRate > 0 ? tickRate : 1);
+	m_maxSteps = (maxSteps > 0 ? maxSteps : 1);
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns the frame rate to limit the game to, or 0 to use VSync instead
+//------------------------------------------------------------------------------------------------------
+void Game::SetTargetFrameRate(int frameRate)
+{
+
+	m_framePacer.SetTargetFrameRate(frameRate);
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that initializes all other managers of the game
 //------------------------------------------------------------------------------------------------------
 bool Game::Initialize(std::string name, int screenWidth, int screenHeight, 
-	                  int pixelScaleValue, bool fullscreen)
+	                  int pixelScaleValue, bool fullscreen, bool headless)
 {
 
 	//initialise game screen with passed values and return false if error occured
-	if(!(TheScreen::Instance()->
-		 Initialize(name.c_str(), screenWidth, screenHeight, pixelScaleValue, 4.0, true, fullscreen)))
+	if(!(TheScreen::Instance()->Initialize(name.c_str(), screenWidth, screenHeight, 
+		                                   pixelScaleValue, 4.0, true, fullscreen, headless)))
 	{
 		return false;
 	}
 
 	//initialize FMOD audio sub-system and return false if error occured
-	if (!(TheAudio::Instance()->Initialize()))
+	if (!(TheAudio::Instance()->Initialize(headless)))
+	{
+		return false;
+	}
+
+	//initialize job manager with one worker thread per core
+	if (!TheJob::Instance()->Initialize())
 	{
 		return false;
 	}
 
-	//initialize shader manager and return false if error occured
-	if (!TheShader::Instance()->Initialize())
+	//without a screen there is nothing to draw, so 
+	//there is no need for the shader and debug managers
+	if (headless)
+	{
+		return true;
+	}
+
+	//create streaming ring buffer for all dynamic vertex data
+	if (!TheStreamBuffer::Instance()->Initialize())
+	{
+		return false;
+	}
+
+	//create point sprite shaders used to draw sprites as single points
+	if (!TheSpriteBatch::Instance()->Initialize())
 	{
 		return false;
 	}
@@ -89,8 +212,12 @@ bool Game::Initialize(std::string name, int screenWidth, int screenHeight,
 bool Game::Run()
 {
 
-	//start SDL timer sub-system
+	//use VSync only if the frame rate is not limited by the frame pacer
+	TheScreen::Instance()->SetVSync(m_framePacer.GetTargetFrameRate() == 0);
+
+	//start SDL timer sub-system and frame timing
 	TheTime::Instance()->Start();
+	m_framePacer.Start();
 
 	//run game indefinately until no more game states are 
 	//available at which point the game loop will break
@@ -109,6 +236,15 @@ bool Game::Run()
 		//set the state's active flag to enable main loop below 
 		m_activeGameState->IsActive() = true;
 
+		//start new state with an empty accumulator
+		m_accumulator = 0.0;
+
+		//make sure any state being preloaded has finished before activating the state
+		if (!WaitForPreload())
+		{
+			return false;
+		}
+
 		//call the active game state's start up tasks
 		if (!(m_activeGameState->OnEnter()))
 		{
@@ -131,20 +267,102 @@ bool Game::Run()
 			//update input handling by listening for input events
 			TheInput::Instance()->Update();
 
-			//update components in active game state
-			if (!m_activeGameState->Update())
+			//in headless mode only update the active game state
+			if (TheScreen::Instance()->IsHeadless())
 			{
-				return false;
+
+				bool isUpdated = UpdateGameState(BeginUpdate());
+				EndUpdate();
+
+				if (!isUpdated)
+				{
+					return false;
+				}
+
+				SceneNode::UpdateAll();
+
 			}
 
-			//draw components in active game state
-			if (!m_activeGameState->Draw())
+			//update components in active game state, store their 
+			//render states and draw them straight after, which is
+			//also done for states that do not draw from render states
+			else if (!m_isPipelined || !m_activeGameState->IsPipelineSafe())
 			{
-				return false;
+
+				bool isUpdated = UpdateGameState(BeginUpdate());
+				EndUpdate();
+
+				if (!isUpdated)
+				{
+					return false;
+				}
+
+				SceneNode::UpdateAll();
+
+				m_activeGameState->StoreRenderStates();
+				m_activeGameState->SetInterpolation(m_interpolation);
+				GameObject::SwapRenderStates();
+
+				if (!DrawGameState())
+				{
+					return false;
+				}
+
+			}
+
+			//in pipelined mode update the next frame on a worker 
+			//thread while the main thread draws the current one
+			else
+			{
+
+				//everything that has to happen on the main thread, like handing out the 
+				//fixed step and updating game objects that are not thread safe, is done 
+				//before the rest of the update is handed over to the worker thread
+				int totalSteps = BeginUpdate();
+
+				for (int i = 0; i < totalSteps && m_activeGameState->IsActive(); i++)
+				{
+					m_activeGameState->UpdateMainThreadGameObjects();
+				}
+
+				//game objects added while the worker thread updates are held back 
+				//so that the vector does not change while the state is being drawn
+				m_activeGameState->IsPipelined() = true;
+
+				bool isUpdated = true;
+				std::atomic<int> counter(0);
+
+				TheJob::Instance()->Run([this, &isUpdated, totalSteps]()
+				{
+					isUpdated = UpdateGameState(totalSteps);
+					SceneNode::UpdateAll();
+					m_activeGameState->StoreRenderStates();
+				}, counter);
+
+				bool isDrawn = DrawGameState();
+
+				//wait for the update to finish before the next frame is drawn
+				TheJob::Instance()->Wait(counter);
+
+				m_activeGameState->IsPipelined() = false;
+				m_activeGameState->AddQueuedGameObjects();
+				EndUpdate();
+
+				if (!isUpdated || !isDrawn)
+				{
+					return false;
+				}
+
+				m_activeGameState->SetInterpolation(m_interpolation);
+				GameObject::SwapRenderStates();
+
 			}
 
-			//draw screen by swapping OpenGL frame buffer
-			TheScreen::Instance()->Draw();
+			//now that nothing is using them anymore, remove all dead game objects
+			m_activeGameState->RemoveDeadGameObjects();
+
+			//wait until the next frame is due if the frame rate is limited
+			m_framePacer.Wait();
 
 		}
 
@@ -163,6 +381,133 @@ bool Game::Run()
 
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that works out how many times the active game state is updated this frame
+//------------------------------------------------------------------------------------------------------
+int Game::BeginUpdate()
+{
+
+	//in variable time step mode update the state once using the elapsed frame time
+	if (!m_isFixedTimeStep)
+	{
+		return 1;
+	}
+
+	//store the real frame time so that it can be restored before drawing
+	m_frameTime = TheTime::Instance()->GetElapsedTimeSeconds();
+
+	//add time passed to accumulator, but never more than the maximum 
+	//amount of steps allowed so that a frame spike is simply dropped
+	m_accumulator += m_frameTime;
+
+	if (m_accumulator > m_timeStep * m_maxSteps)
+	{
+		m_accumulator = m_timeStep * m_maxSteps;
+	}
+
+	//use up as many whole fixed steps as there is time for in the accumulator
+	int totalSteps = (int)(m_accumulator / m_timeStep);
+	totalSteps = (totalSteps < m_maxSteps ? totalSteps : m_maxSteps);
+	m_accumulator -= totalSteps * m_timeStep;
+
+	//hand the fixed step to all update routines instead of the frame time 
+	TheTime::Instance()->SetElapsedTime(m_timeStep * 1000.0);
+
+	return totalSteps;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that updates the active game state the amount of times passed
+//------------------------------------------------------------------------------------------------------
+bool Game::UpdateGameState(int totalSteps)
+{
+
+	//stop early if the state deactivated itself so that it is not updated after closing
+	for (int i = 0; i < totalSteps && m_activeGameState->IsActive(); i++)
+	{
+		if (!m_activeGameState->Update())
+		{
+			return false;
+		}
+	}
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that restores the real frame time and works out the interpolation value after updating
+//------------------------------------------------------------------------------------------------------
+void Game::EndUpdate()
+{
+
+	if (!m_isFixedTimeStep)
+	{
+		m_interpolation = 1.0f;
+		return;
+	}
+
+	//restore the real frame time for all other routines
+	TheTime::Instance()->SetElapsedTime(m_frameTime * 1000.0);
+
+	//the time left over is how far the game is in between two fixed updates
+	m_interpolation = (float)(m_accumulator / m_timeStep);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that draws the active game state and swaps the screen buffers
+//------------------------------------------------------------------------------------------------------
+bool Game::DrawGameState()
+{
+
+	//move streaming ring buffer on to a segment OpenGL is done with
+	//and start counting the OpenGL state calls for this frame afresh
+	TheStreamBuffer::Instance()->BeginFrame();
+	TheStateCache::Instance()->BeginFrame();
+
+	//draw components in active game state
+	if (!m_activeGameState->Draw())
+	{
+		return false;
+	}
+
+	//draw whatever sprites are still waiting in the sprite batch
+	TheSpriteBatch::Instance()->EndFrame();
+
+	//fence off all dynamic vertex data written during this frame
+	TheStreamBuffer::Instance()->EndFrame();
+
+	//draw screen by swapping OpenGL frame buffer
+	TheScreen::Instance()->Draw();
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that waits for the loading thread to finish and returns if preloading was successful
+//------------------------------------------------------------------------------------------------------
+bool Game::WaitForPreload()
+{
+
+	//if no state is being preloaded there is nothing to wait for
+	if (!m_preloadGameState)
+	{
+		return true;
+	}
+
+	m_preloadThread.join();
+	m_preloadGameState = 0;
+	m_isPreloaded = false;
+
+	if (!m_isPreloadSuccessful)
+	{
+		std::cout << "Game state could not be preloaded." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
+
+	return true;
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that closes down all other managers of the game
@@ -170,16 +515,34 @@ bool Game::Run()
 void Game::ShutDown()
 {
 
+	//make sure the loading thread is not still using any managers
+	WaitForPreload();
+
+	//the shader and debug managers are only started up when there is a screen
+	if (!TheScreen::Instance()->IsHeadless())
+	{
+
 //if the game is in debug mode shutdown 
 //debug manager and all its shaders and components 
 #ifdef DEBUG
 
-	TheDebug::Instance()->ShutDown();
+		TheDebug::Instance()->ShutDown();
 
 #endif
 
-	//close down shader manager 
-	TheShader::Instance()->ShutDown();
+		//destroy point sprite shaders and buffers
+		TheSpriteBatch::Instance()->ShutDown();
+
+		//destroy streaming ring buffer
+		TheStreamBuffer::Instance()->ShutDown();
+
+		//close down shader manager 
+		TheShader::Instance()->ShutDown();
+
+	}
+
+	//close down job manager and all worker threads
+	TheJob::Instance()->ShutDown();
 
 	//close down FMOD audio sub-system 
 	TheAudio::Instance()->ShutDown();
@@ -19,16 +19,68 @@
   when the state deactivates, the next active state will be sought out and controlled, until the
   vector contains no more states, at which point the game ends.
 
+- The PreloadNext() function starts preloading the next state in the vector on a separate loading
+  thread, by calling its OnPreload() routine, while the active state keeps on running. The IsReady()
+  and GetLoadProgress() functions can then be used to check if the next state is done preloading,
+  for example to display a loading bar. Only one state can be preloaded at a time. When the next 
+  state is activated, the Run() function waits for its preloading to finish before calling its
+  OnEnter() routine.
+
 - The Initialize() and ShutDown() functions start up and close down all the other managers 
-  respectively.
+  respectively. In headless mode the screen and audio managers are started up as null backends, 
+  and the shader and debug managers are not started at all. The Run() function then only updates
+  the active state without drawing it, as fast as possible or at the target frame rate if one is 
+  set. This is useful for running the game on servers or for benchmarking.
+
+- By default the frame rate is synchronized with the monitor using VSync. The SetTargetFrameRate()
+  function switches VSync off and limits the game to the frame rate passed instead, using the frame
+  pacer, which waits at the end of each frame until the next frame is due. Passing 0 switches VSync
+  back on, or in headless mode lets the game run as fast as possible. The setting is applied when 
+  the Run() function starts.
+
+- By default the active state is updated once per frame using the variable frame time. When the
+  fixed time step flag is set, the Run() function accumulates the frame time and updates the state
+  in fixed steps of 1/tickRate seconds instead, so that gameplay behaves the same at any frame rate.
+  The maximum amount of catch-up steps per frame keeps the simulation cost capped after a frame
+  spike, and any remaining time beyond that is dropped. The left over time in the accumulator is
+  handed to the state as an interpolation value before it is drawn.
+
+- When the pipelined flag is set, the Run() function updates the next frame on a worker thread
+  while the main thread draws the current frame and swaps the screen buffers. This is only done
+  for states that have their pipeline safe flag set, while all other states, like the splash 
+  screens, which draw straight from their game objects, are still updated and drawn in turn. The state being drawn
+  is read from the render states that the game objects stored after the previous update, so that
+  both threads never work on the same data. The render states are swapped once both are done.
+  This means that what is on screen is always one frame behind the simulation, and that the very
+  first frame of a state is drawn empty. Everything that has to happen on the main thread is done
+  before the update is handed over. This is where the fixed step is handed out and where all game
+  objects that are not thread safe are updated, once for each step, ahead of the rest of the state.
+  Game objects added during the update only join the state once both threads are done, and draw
+  routines use the frame time from the Time Manager instead of the elapsed time, which the worker
+  thread may be using as the fixed step at the same time.
+
+- After each update, the world matrices of all scene nodes that were moved are recalculated in one
+  go, so that they are ready for when the render states are stored.
+
+- Before the active state is drawn, the streaming ring buffer moves on to its next segment, and 
+  once it is drawn, the segment is fenced off, so that the dynamic vertex data written during the 
+  frame is not overwritten while the graphics card may still be drawing from it. The counts of 
+  OpenGL state calls sent and skipped by the state cache are also started afresh each frame. Any
+  sprites still waiting in the sprite batch are drawn before the segment is fenced off.
+
+- At the very end of each frame, once the active state has been updated and drawn, all of its dead
+  game objects are removed. In pipelined mode this is the only point where no thread is using them.
 
 */
 
 #ifndef GAME_H
 #define GAME_H
 
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
+#include "FramePacer.h"
 #include "GameState.h"
 #include "Singleton.h"
 
@@ -45,10 +97,23 @@ public:
 	void AddGameState(GameState* gameState);
 	void RemoveGameState(int index);
 
+public:
+
+	bool IsReady();
+	float GetLoadProgress();
+	bool PreloadNext();
+
+public:
+
+	bool& IsPipelined();
+	bool& IsFixedTimeStep();
+	void SetTickRate(int tickRate, int maxSteps = 5);
+	void SetTargetFrameRate(int frameRate);
+
 public:
 
 	bool Initialize(std::string name, int screenWidth, int screenHeight, 
-		            int pixelScaleValue = 0, bool fullscreen = false);
+		            int pixelScaleValue = 0, bool fullscreen = false, bool headless = false);
 	bool Run();
 	void ShutDown();
 
@@ -60,7 +125,31 @@ private:
 
 private:
 
+	int BeginUpdate();
+	bool UpdateGameState(int totalSteps);
+	void EndUpdate();
+	bool DrawGameState();
+	bool WaitForPreload();
+
+private:
+
+	bool m_isPipelined;
+	bool m_isFixedTimeStep;
+
+	int m_maxSteps;
+	double m_timeStep;
+	double m_frameTime;
+	double m_accumulator;
+	float m_interpolation;
+
+	FramePacer m_framePacer;
+
+	std::thread m_preloadThread;
+	std::atomic<bool> m_isPreloaded;
+	std::atomic<bool> m_isPreloadSuccessful;
+
 	GameState* m_activeGameState;
+	GameState* m_preloadGameState;
 	std::vector<GameState*> m_gameStateManager;
 	
 };
@@ -1,4 +1,9 @@
+#include "Bound.h"
 #include "GameObject.h"
+#include "GameState.h"
+
+//index of the render state used for drawing, shared by all game objects
+int GameObject::s_renderStateIndex = 0;
 
 //------------------------------------------------------------------------------------------------------
 //constructor that assigns all defaults 
@@ -9,10 +14,19 @@ GameObject::GameObject()
 	m_isAlive = true;
 	m_isActive = true;
 	m_isVisible = true;
+	m_isThreadSafe = false;
 
-	m_tag = "";
+	m_tagID = Tag::NONE;
 	m_priority = 0;
 
+	m_pool = 0;
+	m_gameState = 0;
+
+	//objects are not drawn before their first render state is stored
+	m_renderStates[0].isActive = m_renderStates[1].isActive = false;
+	m_renderStates[0].isVisible = m_renderStates[1].isVisible = false;
+	m_renderStates[0].isBounded = m_renderStates[1].isBounded = false;
+
 }
 //------------------------------------------------------------------------------------------------------
 //getter-setter function that returns memory flag reference
@@ -42,12 +56,30 @@ bool& GameObject::IsVisible()
 
 }
 //------------------------------------------------------------------------------------------------------
-//getter function that returns game object's tag variable
+//getter-setter function that returns thread safe flag reference
 //------------------------------------------------------------------------------------------------------
-std::string GameObject::GetTag()
+bool& GameObject::IsThreadSafe()
 {
 
-	return m_tag;
+	return m_isThreadSafe;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns game object's tag ID variable
+//------------------------------------------------------------------------------------------------------
+TagID GameObject::GetTagID()
+{
+
+	return m_tagID;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns name of game object's tag, if it was interned
+//------------------------------------------------------------------------------------------------------
+const std::string& GameObject::GetTag()
+{
+
+	return Tag::GetName(m_tagID);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -60,12 +92,39 @@ unsigned int GameObject::GetPriority()
 
 }
 //------------------------------------------------------------------------------------------------------
-//setter function that assigns game object's tag variable
+//getter function that returns pool the game object was created in, if any
 //------------------------------------------------------------------------------------------------------
-void GameObject::SetTag(std::string tag)
+GameObjectPool* GameObject::GetPool()
 {
 
-	m_tag = tag;
+	return m_pool;
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns game object's tag ID variable
+//------------------------------------------------------------------------------------------------------
+void GameObject::SetTag(TagID tagID)
+{
+
+	//let the game state the object is in move it in its tag index as well
+	if (m_gameState)
+	{
+		m_gameState->SetTag(this, tagID);
+	}
+
+	else
+	{
+		m_tagID = tagID;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that interns the tag name passed and assigns its ID
+//------------------------------------------------------------------------------------------------------
+void GameObject::SetTag(const std::string& tag)
+{
+
+	SetTag(Tag::Intern(tag));
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -76,4 +135,100 @@ void GameObject::SetPriority(unsigned int priority)
 
 	m_priority = priority;
 
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns pool the game object was created in
+//------------------------------------------------------------------------------------------------------
+void GameObject::SetPool(GameObjectPool* pool)
+{
+
+	m_pool = pool;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that flips the current and next render state of all game objects
+//------------------------------------------------------------------------------------------------------
+void GameObject::SwapRenderStates()
+{
+
+	s_renderStateIndex = 1 - s_renderStateIndex;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns render state to be used for drawing
+//------------------------------------------------------------------------------------------------------
+RenderState& GameObject::GetRenderState()
+{
+
+	return m_renderStates[s_renderStateIndex];
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that copies all the data needed for drawing into the next render state
+//------------------------------------------------------------------------------------------------------
+void GameObject::StoreRenderState()
+{
+
+	RenderState& renderState = GetNextRenderState();
+
+	renderState.isActive = m_isActive;
+	renderState.isVisible = m_isVisible;
+	renderState.transform = m_transform;
+	renderState.rotation = m_rotation;
+	renderState.previousTransform = m_previousTransform;
+	renderState.previousRotation = m_previousRotation;
+
+	//store where the bound is, so that the bound itself is not 
+	//read while drawing, as it may be updated at the same time
+	Bound* bound = GetBound();
+	renderState.isBounded = (bound && bound->GetExtent(renderState.boundMin, renderState.boundMax));
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that keeps a copy of the transform from before the next update
+//------------------------------------------------------------------------------------------------------
+void GameObject::StorePreviousTransform()
+{
+
+	m_previousTransform = m_transform;
+	m_previousRotation = m_rotation;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that blends the current render state from the previous transform by the amount passed
+//------------------------------------------------------------------------------------------------------
+void GameObject::InterpolateRenderState(float alpha)
+{
+
+	RenderState& renderState = GetRenderState();
+
+	//only the position is lerped, as the matrix also holds the rotation and scale
+	Matrix4D& matrix = renderState.transform.GetMatrix();
+	Matrix4D& previousMatrix = renderState.previousTransform.GetMatrix();
+
+	for (int i = 12; i < 15; i++)
+	{
+		matrix[i] = previousMatrix[i] + (matrix[i] - previousMatrix[i]) * alpha;
+	}
+
+	renderState.rotation = Quaternion::Slerp(renderState.previousRotation, renderState.rotation, alpha);
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns bound used to check if game object is on screen
+//------------------------------------------------------------------------------------------------------
+Bound* GameObject::GetBound()
+{
+
+	return 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns render state that will be drawn once the render states are swapped
+//------------------------------------------------------------------------------------------------------
+RenderState& GameObject::GetNextRenderState()
+{
+
+	return m_renderStates[1 - s_renderStateIndex];
+
 }
\ No newline at end of file
@@ -15,17 +15,25 @@
   principle as Unity's game objects and will be instantiated in the client code at runtime from 
   within the game specific code. It consists of three main flags, m_isAlive, m_isActive and 
   m_isVisible, to signify if the object is exisiting in memory, being used in the game world and 
-  hidden or not from the game world, respectively. Each game object also has a string tag to 
-  identify it amongst other objects, and a priority value for 2D game worlds without a Z-axis, 
-  so that game objects may be drawn in a specific order to give the illusion of depth. Each game
+  hidden or not from the game world, respectively. Each game object also has a tag to identify it
+  amongst other objects, which is stored as a tag ID number instead of a string (see Tag class), 
+  and a priority value for 2D game worlds without a Z-axis, so that game objects may be drawn in 
+  a specific order to give the illusion of depth. Each game
   object automatically has a Transform component to represent its position, rotation and scale. 
   For more flexible rotations, a Quaternion component is also present. All game objects need to be 
   instantiated as sub-classes of this abstract base class.
 												  
+- A tag can be set by ID or by name, which is interned so that GetTag() can return the name. To
+  have the compiler work out the ID, bind it to a constant first, for example constexpr TagID 
+  ENEMY = Tag::Hash("Enemy"), and pass that to SetTag(), because a Hash() call passed straight
+  in is worked out at runtime. Once a game object has been added to a game state, SetTag() hands 
+  the change over to that state, so that the state's tag index is always kept up to date. This
+  means that tags should only be changed on the main thread, and never from a thread safe Update().
+
 - The getters and setters are split into normal ones and combo variants. The combo variants, 
-  IsAlive(), IsActive() and IsVisible() return references to the respective variables because these
-  flag variables may be used frequently and getting and setting them individually may become 
-  inconvenient.
+  IsAlive(), IsActive(), IsVisible() and IsThreadSafe() return references to the respective 
+  variables because these flag variables may be used frequently and getting and setting them 
+  individually may become inconvenient.
 
 - Each game object has a Update() and Draw() function which will be overriden in the sub-class, 
   where the actual main functionality of that object will exist. Generally the Update() routine
@@ -33,6 +41,33 @@
   function is intended for all transformations to be applied to the modelview matrix, as well as
   components and other objects being drawn.
 
+- Game objects are updated on the main thread by default. An object whose Update() routine only
+  changes its own data, and never other game objects or any of the managers, may have its 
+  m_isThreadSafe flag set to true, so that it is updated in parallel on the job manager's worker 
+  threads instead. Only set the flag once the object's Update() routine has been checked for this.
+
+- Game objects created by an object pool hold a pointer to that pool, so that the game state can 
+  hand them back to it instead of deleting them once they are no longer alive. Game objects created
+  with new have no pool and are deleted as normal.
+
+- Each game object keeps two copies of its render state, which is all the data its Draw() routine
+  needs. After updating, the StoreRenderState() routine copies the object's flags and transforms
+  into the next render state, while the Draw() routine reads from the current one using
+  GetRenderState(). Once the frame is over, SwapRenderStates() flips both copies for all game objects
+  at once. This allows the game to update the next frame while the current frame is still being
+  drawn. Sub-classes with more draw data, like sprite colors or texture cells, should override
+  StoreRenderState() and keep a double-buffered copy of that data as well.
+  The game state calls StorePreviousTransform() before each fixed update, so that the render state
+  also holds where the object was one update earlier. When drawing in between two fixed updates, 
+  InterpolateRenderState() then blends the drawn position and rotation from that previous state 
+  towards the current one, so that objects move smoothly even when the tick rate is low.
+  Game objects that are attached to other game objects should use a SceneNode component instead of
+  the Transform component, and store the node's world matrix as their render state's transform.
+
+- Game objects that have a bound should override GetBound() to return it. The render state then 
+  also stores the world space box around the bound, which the game state uses to skip drawing the
+  game object when it is off screen. Game objects without a bound are always drawn.
+
 */
 
 #ifndef GAME_OBJECT_H
@@ -40,7 +75,26 @@
 
 #include <string>
 #include "Quaternion.h"
+#include "Tag.h"
 #include "Transform.h"
+#include "Vector3D.h"
+
+class Bound;
+class GameObjectPool;
+class GameState;
+
+struct RenderState
+{
+	bool isActive;
+	bool isVisible;
+	bool isBounded;
+	Transform transform;
+	Quaternion rotation;
+	Transform previousTransform;
+	Quaternion previousRotation;
+	Vector3D<float> boundMin;
+	Vector3D<float> boundMax;
+};
 
 class GameObject 
 {
@@ -50,36 +104,71 @@ public :
 	GameObject();
 	virtual ~GameObject()   = 0 {}
 
+public :
+
+	friend class GameState;
+
 public :
 
 	bool& IsAlive();
 	bool& IsActive();
 	bool& IsVisible();
+	bool& IsThreadSafe();
 
 public :
 
-	std::string GetTag();
+	TagID GetTagID();
+	const std::string& GetTag();
 	unsigned int GetPriority();
-	void SetTag(std::string tag);
+	GameObjectPool* GetPool();
+	void SetTag(TagID tagID);
+	void SetTag(const std::string& tag);
 	void SetPriority(unsigned int priority);
+	void SetPool(GameObjectPool* pool);
+
+public :
+
+	static void SwapRenderStates();
+	RenderState& GetRenderState();
+	virtual void StoreRenderState();
+	void StorePreviousTransform();
+	void InterpolateRenderState(float alpha);
+	virtual Bound* GetBound();
 
 public :
 
 	virtual void Update()   = 0;
 	virtual bool Draw()     = 0;
 
+protected :
+
+	RenderState& GetNextRenderState();
+
 protected :
 
 	bool m_isAlive;
 	bool m_isActive;
 	bool m_isVisible;
+	bool m_isThreadSafe;
 
-	std::string m_tag;
+	TagID m_tagID;
 	unsigned int m_priority;
 
+	GameObjectPool* m_pool;
+	GameState* m_gameState;
+
 	Transform m_transform;
 	Quaternion m_rotation;
 
+	Transform m_previousTransform;
+	Quaternion m_previousRotation;
+
+	RenderState m_renderStates[2];
+
+private :
+
+	static int s_renderStateIndex;
+
 };
 
 #endif
\ No newline at end of file
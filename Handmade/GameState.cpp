@@ -0,0 +1,272 @@
+#include <algorithm>
+#include "AABB2D.h"
+#include "AABB3D.h"
+#include "GameState.h"
+#include "JobManager.h"
+#include "OBB2D.h"
+#include "OBB3D.h"
+#include "ObjectPool.h"
+#include "Sphere2D.h"
+#include "Sphere3D.h"
+#include "TextureManager.h"
+
+//amount of game objects each worker thread updates in one go
+const int OBJECTS_PER_JOB = 64;
+
+//------------------------------------------------------------------------------------------------------
+//function that loads all resource files for the state on the loading thread
+//------------------------------------------------------------------------------------------------------
+bool GameState::OnPreload()
+{
+
+	//by default there is nothing to preload
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that preloads all image files passed and reports the loading progress after each one
+//------------------------------------------------------------------------------------------------------
+bool GameState::PreloadTextures(const std::vector<std::string>& filenames)
+{
+
+	for (size_t i = 0; i < filenames.size(); i++)
+	{
+		if (!TheTexture::Instance()->Preload(filenames[i]))
+		{
+			return false;
+		}
+
+		SetLoadProgress((float)(i + 1) / filenames.size());
+	}
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that stores the render state of all game objects in vector across all worker threads
+//------------------------------------------------------------------------------------------------------
+void GameState::StoreRenderStates()
+{
+
+	TheJob::Instance()->ParallelFor(m_gameObjects.size(), OBJECTS_PER_JOB,
+		                            [this](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			m_gameObjects[i]->StoreRenderState();
+		}
+	});
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that updates all packed physics, transform and bound components in entity store
+//------------------------------------------------------------------------------------------------------
+void GameState::UpdateEntities()
+{
+
+	//physics needs to be updated first because the others follow the physics position
+	m_entities.UpdatePhysics();
+	m_entities.UpdateTransforms();
+
+	m_entities.UpdateBounds<AABB2D>();
+	m_entities.UpdateBounds<AABB3D>();
+	m_entities.UpdateBounds<OBB2D>();
+	m_entities.UpdateBounds<OBB3D>();
+	m_entities.UpdateBounds<Sphere2D>();
+	m_entities.UpdateBounds<Sphere3D>();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that updates all active game objects in vector across all worker threads
+//------------------------------------------------------------------------------------------------------
+void GameState::UpdateGameObjects()
+{
+
+	//first update all game objects that are not thread safe on the calling thread, 
+	//unless the main thread has already updated them before the pipelined update
+	if (!m_isPipelined)
+	{
+		UpdateMainThreadGameObjects();
+	}
+
+	//then split the vector into chunks and update all the 
+	//thread safe game objects of each chunk on a worker thread
+	TheJob::Instance()->ParallelFor(m_gameObjects.size(), OBJECTS_PER_JOB,
+		                            [this](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			if (m_gameObjects[i]->IsActive() && m_gameObjects[i]->IsThreadSafe())
+			{
+				m_gameObjects[i]->StorePreviousTransform();
+				m_gameObjects[i]->Update();
+			}
+		}
+	});
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that updates all active game objects in vector that are not thread safe
+//------------------------------------------------------------------------------------------------------
+void GameState::UpdateMainThreadGameObjects()
+{
+
+	for (auto it = m_gameObjects.begin(); it != m_gameObjects.end(); it++)
+	{
+		if ((*it)->IsActive() && !(*it)->IsThreadSafe())
+		{
+			(*it)->StorePreviousTransform();
+			(*it)->Update();
+		}
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that adds all game objects held back during a pipelined update
+//------------------------------------------------------------------------------------------------------
+void GameState::AddQueuedGameObjects()
+{
+
+	for (auto it = m_queuedGameObjects.begin(); it != m_queuedGameObjects.end(); it++)
+	{
+		AddGameObject(*it);
+	}
+
+	m_queuedGameObjects.clear();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that returns all game objects with the tag passed
+//------------------------------------------------------------------------------------------------------
+const std::vector<GameObject*>& GameState::FindGameObjects(TagID tagID)
+{
+
+	static const std::vector<GameObject*> s_noGameObjects;
+
+	auto it = m_taggedGameObjects.find(tagID);
+
+	return (it != m_taggedGameObjects.end() ? it->second : s_noGameObjects);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that changes the tag of the game object passed and moves it in the tag index
+//------------------------------------------------------------------------------------------------------
+void GameState::SetTag(GameObject* gameObject, TagID tagID)
+{
+
+	if (gameObject->GetTagID() == tagID)
+	{
+		return;
+	}
+
+	//remove game object from its old tag's vector by moving the last one in its place
+	if (gameObject->GetTagID() != Tag::NONE)
+	{
+
+		std::vector<GameObject*>& gameObjects = m_taggedGameObjects[gameObject->GetTagID()];
+		auto it = std::find(gameObjects.begin(), gameObjects.end(), gameObject);
+
+		if (it != gameObjects.end())
+		{
+			*it = gameObjects.back();
+			gameObjects.pop_back();
+		}
+
+	}
+
+	gameObject->m_tagID = tagID;
+
+	if (tagID != Tag::NONE)
+	{
+		m_taggedGameObjects[tagID].push_back(gameObject);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that adds a game object to the vector and to the index of its tag
+//------------------------------------------------------------------------------------------------------
+void GameState::AddGameObject(GameObject* gameObject)
+{
+
+	//the vector may be being drawn on the main thread during a pipelined update
+	if (m_isPipelined)
+	{
+		m_queuedGameObjects.push_back(gameObject);
+		return;
+	}
+
+	//new game objects start off from where they are instead of being blended in 
+	gameObject->StorePreviousTransform();
+	gameObject->m_gameState = this;
+	m_gameObjects.push_back(gameObject);
+
+	if (gameObject->GetTagID() != Tag::NONE)
+	{
+		m_taggedGameObjects[gameObject->GetTagID()].push_back(gameObject);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that destroys all dead game objects and removes them from the vector in one go
+//------------------------------------------------------------------------------------------------------
+void GameState::RemoveDeadGameObjects()
+{
+
+	//find out which tags have dead game objects, before any of them are destroyed
+	for (auto it = m_gameObjects.begin(); it != m_gameObjects.end(); it++)
+	{
+		if (!(*it)->IsAlive() && (*it)->GetTagID() != Tag::NONE &&
+			std::find(m_deadTags.begin(), m_deadTags.end(), (*it)->GetTagID()) == m_deadTags.end())
+		{
+			m_deadTags.push_back((*it)->GetTagID());
+		}
+	}
+
+	//remove the dead game objects from the index of only those tags
+	for (auto it = m_deadTags.begin(); it != m_deadTags.end(); it++)
+	{
+		std::vector<GameObject*>& gameObjects = m_taggedGameObjects[*it];
+		gameObjects.erase(std::remove_if(gameObjects.begin(), gameObjects.end(),
+			                             [](GameObject* gameObject) { return !gameObject->IsAlive(); }),
+			              gameObjects.end());
+	}
+
+	m_deadTags.clear();
+
+	//move all game objects that are alive to the front of the vector, keeping their
+	//order, and destroy the dead ones along the way so that each is visited only once
+	auto it = std::remove_if(m_gameObjects.begin(), m_gameObjects.end(), 
+		                     [this](GameObject* gameObject)
+	{
+		if (gameObject->IsAlive())
+		{
+			return false;
+		}
+
+		DestroyGameObject(gameObject);
+		return true;
+	});
+
+	//cut off the left over space, which keeps the vector's capacity for reuse
+	m_gameObjects.erase(it, m_gameObjects.end());
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that hands a pooled game object back to its pool or otherwise deletes it
+//------------------------------------------------------------------------------------------------------
+void GameState::DestroyGameObject(GameObject* gameObject)
+{
+
+	gameObject->m_gameState = 0;
+
+	if (gameObject->GetPool())
+	{
+		gameObject->GetPool()->Release(gameObject);
+	}
+
+	else
+	{
+		delete gameObject;
+	}
+
+}
\ No newline at end of file
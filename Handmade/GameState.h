@@ -13,9 +13,8 @@
 - This class encapsulates a game state that will exist within the game. A game state can be 
   anything like a play state, pause state, menu state, etc and will contain all the game
   specific code specific to that state. Every game state needs to be instantiated as a 
-  sub-class of this abstract base class. There is only a header file for this class as there
-  was no need to create a (.cpp) for only two code statements. Ideally, the instantiated game
-  states will be created and controlled inside the Game class.
+  sub-class of this abstract base class. Ideally, the instantiated game states will be created and
+  controlled inside the Game class.
   
 - The main flag variable m_isActive will keep track if the game state is currently active or not. 
   As long as its active, its overriden Update() and Draw() routines will constantly be called until
@@ -27,22 +26,89 @@
   ie - call all shutdown tasks, remove all game objects from memory and free all resources from 
   memory for the given state.
 
+- The OnPreload() routine may be overriden to load all resource files from disk before the state is
+  activated. It is called on a separate loading thread by the Game class while the previous state is
+  still running, so it must only read and decode files and never call any OpenGL functions. The 
+  OnEnter() routine will then finish off creating the OpenGL resources from the preloaded data. While
+  preloading, the state should keep its loading progress (0 to 1) updated using SetLoadProgress().
+  The PreloadTextures() helper does this for each image file it loads, so that a loading screen
+  moves along in steps instead of jumping straight from 0 to 1 once everything is done.
+
+- Each game state has a vector of game objects that can be filled as needed. The UpdateGameObjects()
+  routine updates all active game objects in the vector, splitting them into chunks that are updated
+  in parallel by the job manager's worker threads. Game objects that are not thread safe are all
+  updated first on the calling thread, before the parallel update starts. 
+
+- A state may only be updated on a worker thread while the main thread draws if everything its
+  Draw() routine reads is stored in the render states, or never changes during an update. Such a
+  state sets its pipeline safe flag, and all other states are always updated and drawn in turn,
+  even when the game runs in pipelined mode. When the Game class does run the update on a worker
+  thread while the main thread draws, it sets the pipelined flag. The game objects that are not 
+  thread safe are then updated on the main thread beforehand using UpdateMainThreadGameObjects(),
+  and are skipped by UpdateGameObjects(). Game objects added with AddGameObject() are held back 
+  until AddQueuedGameObjects() is called once both threads are done, so that the vector never 
+  changes while it is being drawn.
+
+- Game objects that are no longer alive are not removed straight away, because other game objects 
+  or the render states may still point to them during the frame. Instead the Game class calls the
+  RemoveDeadGameObjects() routine at the end of each frame, once updating and drawing are done, 
+  which destroys all dead game objects and closes the gaps in the vector in one single pass. The
+  DestroyGameObject() routine hands pooled game objects back to their pool and deletes all others,
+  and should also be used to destroy the remaining game objects in OnExit().
+
+- Alongside the vector, each game state keeps a tag index, which holds a separate vector of all the
+  game objects for each tag in use. The FindGameObjects() function returns the vector for the tag
+  passed, so finding all enemies only runs through the enemies instead of the entire game world.
+  To keep the index up to date, game objects should be added using AddGameObject(), after which 
+  their own SetTag() routine hands any tag change over to the game state's SetTag() routine. 
+  Untagged game objects are not indexed. Dead game objects are removed from the index when they 
+  are removed from the vector.
+
+- Each game state also hosts an entity store, for large amounts of simple entities that are better
+  stored as packed components than as separate game objects. The UpdateEntities() routine updates
+  all their physics components first, and then moves their transforms and bounds along with them.
+
+- The StoreRenderStates() routine is called by the Game class after each update, and stores the
+  render states of all the game objects in the vector so that they can be drawn in the next frame. 
+  States with game objects that are not in the vector should override it and store those too.
+
+- When the game runs with a fixed time step, Update() may be called several times or not at all
+  in one frame. The m_interpolation value is set by the Game class before each Draw() call and
+  holds how far (0 to 1) the game is in between the last and the next fixed update. States draw
+  their game objects smoothly in between their previous and current state by passing it to each
+  game object's InterpolateRenderState() routine before drawing it.
+
 */
 
 #ifndef GAME_STATE_H
 #define GAME_STATE_H
 
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "EntityStore.h"
+#include "GameObject.h"
+
 class GameState
 {
 
 public:
 	
-	GameState()                            { m_isActive = false; }
+	GameState()                            { m_isActive = false; m_isPipelineSafe = false;
+	                                         m_isPipelined = false; m_interpolation = 1.0f; 
+	                                         m_loadProgress = 0.0f; }
 	virtual ~GameState()              = 0  {}
 
 public:
 
 	bool& IsActive()                       { return m_isActive; }
+	bool& IsPipelineSafe()                 { return m_isPipelineSafe; }
+	bool& IsPipelined()                    { return m_isPipelined; }
+	float GetInterpolation()               { return m_interpolation; }
+	void SetInterpolation(float alpha)     { m_interpolation = alpha; }
+	float GetLoadProgress()                { return m_loadProgress; }
+	void SetLoadProgress(float progress)   { m_loadProgress = progress; }
 
 public:
 
@@ -51,9 +117,43 @@ public:
 	virtual bool Draw()               = 0;
 	virtual void OnExit()             = 0;
 
+public:
+
+	virtual bool OnPreload();
+	virtual void StoreRenderStates();
+	void UpdateMainThreadGameObjects();
+	void AddQueuedGameObjects();
+	void RemoveDeadGameObjects();
+
+public:
+
+	const std::vector<GameObject*>& FindGameObjects(TagID tagID);
+	void SetTag(GameObject* gameObject, TagID tagID);
+
+protected:
+
+	bool PreloadTextures(const std::vector<std::string>& filenames);
+	void UpdateEntities();
+	void UpdateGameObjects();
+	void AddGameObject(GameObject* gameObject);
+	void DestroyGameObject(GameObject* gameObject);
+
 protected:
 
 	bool m_isActive;
+	bool m_isPipelineSafe;
+	bool m_isPipelined;
+	float m_interpolation;
+	std::atomic<float> m_loadProgress;
+
+	EntityStore m_entities;
+	std::vector<GameObject*> m_gameObjects;
+	std::unordered_map<TagID, std::vector<GameObject*>> m_taggedGameObjects;
+
+private:
+
+	std::vector<TagID> m_deadTags;
+	std::vector<GameObject*> m_queuedGameObjects;
 
 };
 
@@ -27,7 +27,7 @@ class Grid : public GameObject
 
 public:
 
-	Grid()                {}
+	Grid()                { m_isThreadSafe = true; }
 	virtual ~Grid()       {}
 
 public:
@@ -27,6 +27,9 @@ HUD::HUD()
 	//create screen position for sprite object based on screen height
 	m_transform.Translate(110.0f, (float)(TheScreen::Instance()->GetScreenSize().Y - 80));
 
+	//the HUD does nothing when updated so it can safely be updated on any thread
+	m_isThreadSafe = true;
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that displays the 2D heads-up display on screen
@@ -34,19 +37,14 @@ HUD::HUD()
 bool HUD::Draw()
 {
 
-	//temporarily disable debug shaders
-	TheDebug::Instance()->Disable();
-
 	//setup screen in 2D orthographic mode because all HUDS are 2D 
 	TheScreen::Instance()->Set2DScreen(ScreenManager::BOTTOM_LEFT);
 
 	//set modelview matrix to identity for a fresh new 2D start point
 	TheScreen::Instance()->ModelViewMatrix() = Matrix4D::IDENTITY;
 
-	//temporarily attach and link main program shaders
-	TheShader::Instance()->Attach(ShaderManager::VERTEX_SHADER, "MAIN_VERTEX_SHADER");
-	TheShader::Instance()->Attach(ShaderManager::FRAGMENT_SHADER, "MAIN_FRAGMENT_SHADER");
-	TheShader::Instance()->Link();
+	//temporarily switch to the main shader program
+	TheShader::Instance()->UseProgram("MAIN_PROGRAM");
 
 	//link shader attribute variables to sprite object
 	m_sprite.SetShaderAttribute("vertexIn", "colorIn", "textureIn");
@@ -54,23 +52,20 @@ bool HUD::Draw()
 	//move to top left corner of screen, apply position to modelview matrix 
 	TheScreen::Instance()->ModelViewMatrix() * m_transform.GetMatrix();
 	
-	//send all matrix data to shaders
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("projectionMatrix"),
-		                              TheScreen::Instance()->ProjectionMatrix().GetMatrixArray());
-
-	TheShader::Instance()->SetUniform(TheShader::Instance()->GetUniform("modelviewMatrix"),
+	//send modelview matrix data to shaders
+	TheShader::Instance()->SetUniform(TheShader::Instance()->GetModelviewUniform(),
 		                              TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
 
 	//draw HUD image
 	m_sprite.Draw();
 
-	//detach main program shaders
-	TheShader::Instance()->Detach(ShaderManager::VERTEX_SHADER, "MAIN_VERTEX_SHADER");
-	TheShader::Instance()->Detach(ShaderManager::FRAGMENT_SHADER, "MAIN_FRAGMENT_SHADER");
+#ifdef DEBUG
 
-	//re-enable debug shaders
+	//switch back to the debug shader program
 	TheDebug::Instance()->Enable();
 
+#endif
+
 	return true;
 
 }
@@ -156,19 +156,6 @@ void InputManager::Update()
 	//variable to store SDL event data
 	SDL_Event events;
 
-	//if no events are occuring, then put CPU to sleep for a millisecond
-	//this prevents CPU from running too much 
-	if(!SDL_PollEvent(&events)) 
-	{
-		SDL_Delay(1);
-	}
-	
-	//if previous event was valid, push it back on queue to be processed
-	else 
-	{
-		SDL_PushEvent(&events);
-	}
-
 	//reset window quitting flag 
 	m_isXClicked = false;
 
@@ -181,8 +168,9 @@ void InputManager::Update()
 	//store state of keyboard in array
 	m_keyStates = SDL_GetKeyboardState(0);
 
-	//check for events on SDL event queue
-	//keep this loop running until all events have been processed
+	//check for events on SDL event queue and keep this loop running until all events 
+	//have been processed, the loop never waits for new events so that it never adds 
+	//latency to the frame, as the frame rate is limited by the Game class instead
 	while(SDL_PollEvent(&events))
 	{
 			
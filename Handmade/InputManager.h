@@ -46,7 +46,9 @@
 - The Update() function is the core of the Input Manager class. It will process all SDL events that
   build up on the event queue and will store particular keyboard and mouse property values in the 
   relevant variables. These values can then be used at any time in the client code. This routine will
-  need to be called once per frame in the client code.
+  need to be called once per frame in the client code. All pending events are drained in one single 
+  pass and the routine never sleeps, so that input is never held back. Limiting the frame rate is 
+  left to the Game class' frame pacer.
 
 */
 
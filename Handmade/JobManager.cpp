@@ -0,0 +1,274 @@
+#include <iostream>
+#include "JobManager.h"
+
+//each thread remembers which job queue it owns
+//the main thread and all other non-worker threads use the first queue
+static thread_local int s_queueIndex = 0;
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+JobManager::JobManager()
+{
+
+	m_isRunning = false;
+	m_totalQueuedTasks = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of worker threads running
+//------------------------------------------------------------------------------------------------------
+int JobManager::GetTotalWorkers()
+{
+
+	return m_workers.size();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates all job queues and starts up the worker threads
+//------------------------------------------------------------------------------------------------------
+bool JobManager::Initialize(int totalWorkers)
+{
+
+	//if no amount of workers is passed create one worker for each core
+	//leaving one core free because the main thread also runs jobs
+	if (totalWorkers < 0)
+	{
+		totalWorkers = std::thread::hardware_concurrency() - 1;
+		totalWorkers = (totalWorkers > 0 ? totalWorkers : 0);
+	}
+
+	//create one job queue for the main thread and one for each worker
+	for (int i = 0; i <= totalWorkers; i++)
+	{
+		m_jobQueues.push_back(new JobQueue);
+	}
+
+	m_isRunning = true;
+
+	//start all worker threads, each with their own job queue
+	for (int i = 1; i <= totalWorkers; i++)
+	{
+		m_workers.push_back(std::thread(&JobManager::RunWorker, this, i));
+	}
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that adds a job to the calling thread's queue and ties it to the counter passed
+//------------------------------------------------------------------------------------------------------
+void JobManager::Run(const Job& job, std::atomic<int>& counter)
+{
+
+	//if job manager has not been initialized run job straight away
+	if (m_jobQueues.empty())
+	{
+		job();
+		return;
+	}
+
+	Task task = { job, &counter };
+	counter++;
+
+	//count the job before it is added, so that a worker taking it 
+	//straight away can never bring the amount of queued jobs below zero
+	m_totalQueuedTasks++;
+
+	//add job to the back of the calling thread's own queue
+	m_jobQueues[s_queueIndex]->mutex.lock();
+	m_jobQueues[s_queueIndex]->tasks.push_back(task);
+	m_jobQueues[s_queueIndex]->mutex.unlock();
+
+	//wake up one sleeping worker, the lock makes sure the worker
+	//is not in between checking for jobs and going to sleep
+	m_sleepMutex.lock();
+	m_sleepMutex.unlock();
+	m_sleepCondition.notify_one();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that keeps running jobs until all jobs tied to the counter passed have finished
+//------------------------------------------------------------------------------------------------------
+void JobManager::Wait(std::atomic<int>& counter)
+{
+
+	Task task;
+
+	while (counter > 0)
+	{
+
+		//help out with other jobs instead of waiting idle
+		//if there are none left, give up the rest of the time slice
+		if (FindTask(s_queueIndex, task))
+		{
+			RunTask(task);
+		}
+
+		else
+		{
+			std::this_thread::yield();
+		}
+
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that splits the index range into chunks and runs each chunk as a separate job
+//------------------------------------------------------------------------------------------------------
+void JobManager::ParallelFor(int totalIndices, int chunkSize, const RangeJob& job)
+{
+
+	//make sure chunks always contain at least one index
+	chunkSize = (chunkSize > 0 ? chunkSize : 1);
+
+	//if there is not enough work to split or no workers to
+	//share it with, run the entire range on the calling thread
+	if (totalIndices <= chunkSize || m_workers.empty())
+	{
+
+		if (totalIndices > 0)
+		{
+			job(0, totalIndices);
+		}
+
+		return;
+
+	}
+
+	std::atomic<int> counter(0);
+
+	//add a job for each chunk of the range, the last chunk may be smaller
+	for (int begin = 0; begin < totalIndices; begin += chunkSize)
+	{
+		int end = (begin + chunkSize < totalIndices ? begin + chunkSize : totalIndices);
+		Run([&job, begin, end]() { job(begin, end); }, counter);
+	}
+
+	Wait(counter);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that stops all worker threads and destroys all job queues
+//------------------------------------------------------------------------------------------------------
+void JobManager::ShutDown()
+{
+
+	//flag all workers to stop and wake them all up
+	m_sleepMutex.lock();
+	m_isRunning = false;
+	m_sleepMutex.unlock();
+	m_sleepCondition.notify_all();
+
+	//wait for each worker to finish its current job and end
+	for (auto it = m_workers.begin(); it != m_workers.end(); it++)
+	{
+		it->join();
+	}
+
+	//any jobs still in the queues at this point will never run
+	if (m_totalQueuedTasks > 0)
+	{
+		std::cout << "Job manager shut down with " << m_totalQueuedTasks
+			      << " job(s) still queued." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+	}
+
+	for (auto it = m_jobQueues.begin(); it != m_jobQueues.end(); it++)
+	{
+		delete (*it);
+	}
+
+	m_workers.clear();
+	m_jobQueues.clear();
+	m_totalQueuedTasks = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that finds a job either from the thread's own queue or by stealing from another queue
+//------------------------------------------------------------------------------------------------------
+bool JobManager::FindTask(int queueIndex, Task& task)
+{
+
+	//no need to lock any queues if there are no jobs at all
+	if (m_totalQueuedTasks == 0)
+	{
+		return false;
+	}
+
+	int totalQueues = m_jobQueues.size();
+
+	//first look in own queue and then in all other queues one after the other
+	for (int i = 0; i < totalQueues; i++)
+	{
+
+		JobQueue* jobQueue = m_jobQueues[(queueIndex + i) % totalQueues];
+		std::lock_guard<std::mutex> lock(jobQueue->mutex);
+
+		if (!jobQueue->tasks.empty())
+		{
+
+			//take newest job from own queue because its data is most
+			//likely still in the cache and steal oldest job from others
+			if (i == 0)
+			{
+				task = jobQueue->tasks.back();
+				jobQueue->tasks.pop_back();
+			}
+
+			else
+			{
+				task = jobQueue->tasks.front();
+				jobQueue->tasks.pop_front();
+			}
+
+			m_totalQueuedTasks--;
+			return true;
+
+		}
+
+	}
+
+	return false;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that runs the job and flags it as finished on its counter
+//------------------------------------------------------------------------------------------------------
+void JobManager::RunTask(Task& task)
+{
+
+	task.job();
+	(*task.counter)--;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that each worker thread runs until the job manager is shut down
+//------------------------------------------------------------------------------------------------------
+void JobManager::RunWorker(int queueIndex)
+{
+
+	//let the thread know which queue belongs to it
+	s_queueIndex = queueIndex;
+
+	Task task;
+
+	while (m_isRunning)
+	{
+
+		//run the next job found
+		if (FindTask(queueIndex, task))
+		{
+			RunTask(task);
+		}
+
+		//otherwise sleep until a new job is added or the job manager shuts down
+		else
+		{
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_sleepCondition.wait(lock, [this]() { return !m_isRunning || m_totalQueuedTasks > 0; });
+		}
+
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates a job manager which spreads work over all the CPU cores. It creates one
+  worker thread per core, minus one for the main thread, which also takes part in running jobs
+  while it is waiting for them to finish. Each thread owns its own job queue. A thread always takes
+  the newest job from the back of its own queue, and when it runs out of work it steals the oldest
+  job from the front of another thread's queue. This keeps all cores busy without one single queue
+  becoming a bottleneck. Workers with nothing to do sleep until a new job is added. This class is
+  a Singleton.
+
+- A job is any function with no parameters and no return value. Every job is tied to a counter,
+  which is increased when the job is added with Run() and decreased when it has finished. The
+  Wait() routine will keep running other jobs until the counter reaches zero, so that the thread
+  waiting never sits idle and jobs may safely add and wait for more jobs themselves.
+
+- The ParallelFor() routine splits a range of indices into chunks of the size passed and runs each
+  chunk as a separate job, returning only once all of them are done. Ranges that fit into one chunk,
+  or when there are no worker threads, are run straight away on the calling thread.
+
+- Only one thread should call Initialize() and ShutDown(), which is done from the Game class.
+
+*/
+
+#ifndef JOB_MANAGER_H
+#define JOB_MANAGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Singleton.h"
+
+class JobManager
+{
+
+public:
+
+	typedef std::function<void()> Job;
+	typedef std::function<void(int, int)> RangeJob;
+
+public:
+
+	friend class Singleton<JobManager>;
+
+public:
+
+	int GetTotalWorkers();
+
+public:
+
+	bool Initialize(int totalWorkers = -1);
+	void Run(const Job& job, std::atomic<int>& counter);
+	void Wait(std::atomic<int>& counter);
+	void ParallelFor(int totalIndices, int chunkSize, const RangeJob& job);
+	void ShutDown();
+
+private:
+
+	struct Task
+	{
+		Job job;
+		std::atomic<int>* counter;
+	};
+
+	struct JobQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+private:
+
+	JobManager();
+	JobManager(const JobManager&);
+	JobManager& operator=(const JobManager&);
+
+private:
+
+	bool FindTask(int queueIndex, Task& task);
+	void RunTask(Task& task);
+	void RunWorker(int queueIndex);
+
+private:
+
+	std::atomic<bool> m_isRunning;
+	std::atomic<int> m_totalQueuedTasks;
+
+	std::mutex m_sleepMutex;
+	std::condition_variable m_sleepCondition;
+
+	std::vector<std::thread> m_workers;
+	std::vector<JobQueue*> m_jobQueues;
+
+};
+
+typedef Singleton<JobManager> TheJob;
+
+#endif
\ No newline at end of file
@@ -13,7 +13,8 @@
 - This is the main starting point for the game demo. The main game state is created here and added
   to the main game manager, from where it is run. Change the screen width and height accordingly, 
   and set the pixel per unit value to whichever value you find most comfortable when in 2D mode. 
-  Feel free to create and add more game states.
+  Feel free to create and add more game states. Pass "-headless" on the command line to run the 
+  game without a window, graphics or audio output.
 
 */
 
@@ -49,9 +50,12 @@ int main(int argc, char* args[])
 	GameState* mainState;
 	GameState* endState;
 
+	//run game in headless mode if requested on the command line
+	bool headless = (argc > 1 && std::string(args[1]) == "-headless");
+
 	//initialize game with name, width and height accordingly
-	//set last parameter to true for fullscreen mode!
-	TheGame::Instance()->Initialize(gameName, screenWidth, screenHeight, pixelsPerUnit, false);
+	//set fifth parameter to true for fullscreen mode!
+	TheGame::Instance()->Initialize(gameName, screenWidth, screenHeight, pixelsPerUnit, false, headless);
 
 	//create all states for game 
 	startState = new StartState();
@@ -43,6 +43,7 @@ void MainCamera::Update()
 {
 
 	m_isActive = CheckInput();
+	m_camera.Update();
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -52,12 +53,20 @@ bool MainCamera::Draw()
 {
 
 	TheScreen::Instance()->ModelViewMatrix() = Matrix4D::IDENTITY;
-
-	m_camera.Update();
-	m_camera.Draw();
+	TheScreen::Instance()->ModelViewMatrix() * GetRenderState().transform.GetMatrix();
 
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that stores the camera view in the next render state
+//------------------------------------------------------------------------------------------------------
+void MainCamera::StoreRenderState()
+{
+
+	GameObject::StoreRenderState();
+	GetNextRenderState().transform.GetMatrix() = m_camera.GetViewMatrix();
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that reads keypresses and mouse motion
@@ -15,10 +15,11 @@
   routine that reads keypresses and mouse motions to determine which way the camera will be moving
   and rotating. The Update() function will constantly call this routine and if it returns false it
   means the player pressed ESCAPE and wishes to quit, which will set the camera's m_active flag 
-  accordingly. The camera determines when the game state ends. The Draw() function will reset the 
-  modelview matrix and set up the camera accordingly. This should be done before each and every 
-  other game object is drawn on screen, meaning that this camera's Draw() routine should be called
-  before all other game objects are drawn. 
+  accordingly. The camera determines when the game state ends. The Update() function also moves the 
+  camera, and its view is stored in the render state by StoreRenderState(). The Draw() function will
+  reset the modelview matrix and set up the camera view from the render state accordingly. This 
+  should be done before each and every other game object is drawn on screen, meaning that this 
+  camera's Draw() routine should be called before all other game objects are drawn. 
 
 */
 
@@ -40,6 +41,7 @@ public:
 
 	virtual void Update();
 	virtual bool Draw();
+	virtual void StoreRenderState();
 
 private :
 
@@ -1,4 +1,5 @@
 #include "BufferManager.h"
+#include "Game.h"
 #include "MainState.h"
 #include "ScreenManager.h"
 #include "ShaderManager.h"
@@ -22,9 +23,23 @@ bool MainState::OnEnter()
 	//create a heads-up display object
 	m_HUD = new HUD();
 
+	m_totalCulled = 0;
+	m_totalVisible = 0;
+
+	//start loading the end state while this state runs
+	TheGame::Instance()->PreloadNext();
 
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that loads the HUD image on the loading thread before the state is entered
+//------------------------------------------------------------------------------------------------------
+bool MainState::OnPreload()
+{
+
+	return PreloadTextures({ "Sprites\\HUD.png" });
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that updates all active game objects in game state
@@ -39,17 +54,24 @@ bool MainState::Update()
 	//set game state active flag based on camera flag 
 	m_isActive = m_mainCamera->IsActive();
 
-	//loop through all game objects in vector and update them only if they are active
-	for (auto it = m_gameObjects.begin(); it != m_gameObjects.end(); it++)
-	{
-		if ((*it)->IsActive())
-		{
-			(*it)->Update();
-		}
-	}	
+	//update all active game objects in vector across all worker threads
+	UpdateGameObjects();
+
+	//update all packed components in entity store across all worker threads
+	UpdateEntities();
 
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that stores the render state of the camera and all game objects in game state
+//------------------------------------------------------------------------------------------------------
+void MainState::StoreRenderStates()
+{
+
+	m_mainCamera->StoreRenderState();
+	GameState::StoreRenderStates();
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that displays all active and visible game objects in game state
@@ -74,28 +96,106 @@ bool MainState::Draw()
 
 #ifdef DEBUG
 
+	TheScreen::Instance()->PushMatrix();
 	m_grid->Draw();
+	TheScreen::Instance()->PopMatrix();
 
 #endif
 
-	//loop through all game objects in vector and 
-	//display them only if they are active and visible
+	//the modelview matrix only holds the camera view at this point
+	//so the frustum planes end up in world space, where the bounds are
+	m_frustum.SetFrustum(TheScreen::Instance()->ProjectionMatrix(), 
+		                 TheScreen::Instance()->ModelViewMatrix());
+
+	int totalCulled = 0;
+	int totalVisible = 0;
+
+	//loop through all game objects in vector and display them only
+	//if they are active and visible and not completely off screen
+	//each game object works on its own copy of the camera view, 
+	//so that the camera view only needs to be calculated once
 	for (auto it = m_gameObjects.begin(); it != m_gameObjects.end(); it++)
 	{
-		//set up camera view before each game object is drawn 
-		m_mainCamera->Draw();
-		
-		if ((*it)->IsActive() && (*it)->IsVisible())
+
+		RenderState& renderState = (*it)->GetRenderState();
+
+		if (renderState.isActive && renderState.isVisible)
 		{
+
+			if (!IsOnScreen(renderState))
+			{
+				totalCulled++;
+				continue;
+			}
+
+			//blend in between the last two fixed updates when there is time left over
+			if (m_interpolation < 1.0f)
+			{
+				(*it)->InterpolateRenderState(m_interpolation);
+			}
+
+			TheScreen::Instance()->PushMatrix();
 			(*it)->Draw();
+			TheScreen::Instance()->PopMatrix();
+
+			totalVisible++;
+
 		}
+
 	}
 
+	m_totalCulled = totalCulled;
+	m_totalVisible = totalVisible;
+
 	//display the heads-up display last
 	m_HUD->Draw();
 
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of game objects skipped in last frame for being off screen
+//------------------------------------------------------------------------------------------------------
+int MainState::GetTotalCulled()
+{
+
+	return m_totalCulled;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of game objects drawn in last frame
+//------------------------------------------------------------------------------------------------------
+int MainState::GetTotalVisible()
+{
+
+	return m_totalVisible;
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if game object's bound is at least partly on screen
+//------------------------------------------------------------------------------------------------------
+bool MainState::IsOnScreen(RenderState& renderState)
+{
+
+	//game objects without a bound cannot be checked so are always drawn
+	if (!renderState.isBounded)
+	{
+		return true;
+	}
+
+#ifdef GAME_3D
+
+	return m_frustum.IsBoxVisible(renderState.boundMin, renderState.boundMax);
+
+#endif
+
+#ifdef GAME_2D
+
+	return m_frustum.IsRectangleVisible(Vector2D<float>(renderState.boundMin.X, renderState.boundMin.Y),
+		                                Vector2D<float>(renderState.boundMax.X, renderState.boundMax.Y));
+
+#endif
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that destroys all the game objects for the state
@@ -104,13 +204,18 @@ void MainState::OnExit()
 {
 
 	//loop through all game objects in vector and remove them from memory
+	//pooled game objects are handed back to their pool instead
 	for (auto it = m_gameObjects.begin(); it != m_gameObjects.end(); it++)
 	{
-		delete (*it);
+		DestroyGameObject(*it);
 	}
 
-	//clear the game object vector
+	//clear the game object vector and tag index
 	m_gameObjects.clear();
+	m_taggedGameObjects.clear();
+
+	//destroy all entities and their components
+	m_entities.Clear();
 
 	//destroy the HUD, camera and grid objects
 	delete m_HUD;
@@ -20,15 +20,27 @@
   last, which means it's better to have them treated as separate objects.
 
 - The Update() function will update the main camera and all the game objects in the vector, as long
-  as they are active. 
+  as they are active. The game objects are updated in parallel using the base class' routine, after 
+  which all entities in the entity store are updated.
 
 - The Draw() routine draws all the game objects in the vector, as long as they are active and 
-  visible. It also draws the main camera before each game object in the loop. This is done because
-  the camera sets up the view of the modelview matrix and this needs to be done before each game
-  object is drawn on screen. Based on if the game is in 2D or 3D mode, the Draw() function also
-  sets up the projection to orthographic or perspective respectively. This is because in 3D mode the
-  projection temporarily changes to 2D for the HUD, so it needs to be reset to perspective. In 2D
-  mode it just remains orthographic.
+  visible. It draws the main camera once before the loop, which sets up the view of the modelview
+  matrix, and then pushes a copy of that view for each game object, which is popped once the game
+  object is drawn, so that each game object starts off from the same camera view. Based on if the 
+  game is in 2D or 3D mode, the Draw() function also sets up the projection to orthographic or 
+  perspective respectively. This is because in 3D mode the projection temporarily changes to 2D 
+  for the HUD, so it needs to be reset to perspective. In 2D mode it just remains orthographic.
+
+- Before drawing the game objects, the Draw() routine works out the view frustum from the projection
+  and camera view, and any game object whose bound lies completely outside of it is skipped. In 2D
+  mode only the screen edges are checked. The amount of game objects skipped and drawn in the last 
+  frame can be requested with the GetTotalCulled() and GetTotalVisible() functions.
+
+- All game objects, including the main camera, are drawn using their stored render states, which is
+  why the StoreRenderStates() routine also stores the camera's render state. The HUD never changes
+  once it is created, so the state is safe to be updated on a worker thread while it is drawn. When
+  the game runs with a fixed time step, each game object is blended in between its last two fixed
+  updates before it is drawn, using the interpolation value handed over by the Game class.
 
 */
 
@@ -36,6 +48,7 @@
 #define MAIN_STATE_H
 
 #include <vector>
+#include "Frustum.h"
 #include "GameObject.h"
 #include "GameState.h"
 #include "Grid.h"
@@ -48,24 +61,41 @@ class MainState : public GameState
 
 public:
 
-	MainState()          {}
+	MainState()          { m_isPipelineSafe = true; }
 	virtual ~MainState() {}
 
 public:
 
 	virtual bool OnEnter();
+	virtual bool OnPreload();
 	virtual bool Update();
 	virtual bool Draw();
 	virtual void OnExit();
 
+public:
+
+	virtual void StoreRenderStates();
+
+public:
+
+	int GetTotalCulled();
+	int GetTotalVisible();
+
 private :
 
+	bool IsOnScreen(RenderState& renderState);
+
+private :
+
+	int m_totalCulled;
+	int m_totalVisible;
+
+	Frustum m_frustum;
+
 	HUD* m_HUD;
 	Grid* m_grid;
 	MainCamera* m_mainCamera;
 
-	std::vector<GameObject*> m_gameObjects;
-
 };
 
 #endif
\ No newline at end of file
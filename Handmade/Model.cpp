@@ -1,5 +1,6 @@
 #include <fstream>
 #include <iostream>
+#include <tuple>
 #include "Model.h"
 #include "TextureManager.h"
 #include "Tools.h"
@@ -12,8 +13,10 @@
 Model::Model()
 {
 
-	//assign ID to a default 0
-	m_textureID = 0;
+	//start off with a null handle that refers to no texture
+	m_texture = Handle();
+
+	m_isPreloaded = false;
 
 	//set texture color to a default white color
 	m_color = Color::WHITE;
@@ -22,6 +25,9 @@ Model::Model()
 	m_buffer.SetComponentSize(Buffer::VERTEX_BUFFER, Buffer::XYZ);
 	m_buffer.SetComponentSize(Buffer::COLOR_BUFFER, Buffer::RGBA);
 
+	//store all vertex data in one interleaved VBO drawn using a VAO
+	m_buffer.IsInterleaved() = true;
+
 }
 //------------------------------------------------------------------------------------------------------
 //setter function that assigns color of model
@@ -57,12 +63,12 @@ void Model::SetColor(Color& color)
 
 }
 //------------------------------------------------------------------------------------------------------
-//setter function that assigns texture image ID to model based on index value passed
+//setter function that assigns texture image handle to model based on index value passed
 //------------------------------------------------------------------------------------------------------
 void Model::SetTextureID(const std::string& mapIndex)
 {
 
-	m_textureID = TheTexture::Instance()->GetTextureID(mapIndex);
+	m_texture = TheTexture::Instance()->GetTexture(mapIndex);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -92,9 +98,47 @@ void Model::SetShaderAttribute(const std::string& vertexAttr, const std::string&
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that opens, loads and stores OBJ and MTL model file data based on filenames passed
+//setter function that assigns per-instance shader attribute IDs based on attribute names passed
 //------------------------------------------------------------------------------------------------------
-bool Model::LoadFromFile(const std::string& OBJfilename, const std::string& MTLfilename)
+void Model::SetInstanceAttribute(const std::string& matrixAttr, const std::string& colorAttr)
+{
+
+	m_buffer.SetInstanceAttributeID(matrixAttr, colorAttr);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that adds a copy of the model to be drawn with the transformation and color passed
+//------------------------------------------------------------------------------------------------------
+void Model::AddInstance(Matrix4D& transform, const Color& color)
+{
+
+	//add the entire matrix followed by the color
+	GLfloat* matrix = transform.GetMatrixArray();
+	m_buffer.Instances().insert(m_buffer.Instances().end(), matrix, matrix + 16);
+
+	m_buffer.Instances().push_back(color.R);
+	m_buffer.Instances().push_back(color.G);
+	m_buffer.Instances().push_back(color.B);
+	m_buffer.Instances().push_back(color.A);
+
+	//flag instance VBO to be filled with new data
+	m_buffer.FillInstanceData();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes all copies of the model
+//------------------------------------------------------------------------------------------------------
+void Model::ClearInstances()
+{
+
+	m_buffer.Instances().clear();
+	m_buffer.FillInstanceData();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that opens, loads and stores OBJ and MTL model file data without filling the VBOs
+//------------------------------------------------------------------------------------------------------
+bool Model::Preload(const std::string& OBJfilename, const std::string& MTLfilename)
 {
 
 	//variables for storing various string text from 
@@ -111,6 +155,8 @@ bool Model::LoadFromFile(const std::string& OBJfilename, const std::string& MTLf
 	std::vector<Vector3D<GLfloat>> tempVertices;
 	std::vector<Vector3D<GLfloat>> tempNormals;
 
+	std::map<std::tuple<GLuint, GLuint, GLuint>, GLuint> tempIndices;
+
 	//-----------------------------------------------------------------------------------------------------
 	//OBJ FILE
 	//-----------------------------------------------------------------------------------------------------
@@ -294,11 +340,26 @@ bool Model::LoadFromFile(const std::string& OBJfilename, const std::string& MTLf
 	std::cout << "File opened and read successfully." << std::endl;
 	std::cout << "---------------------------------------------------------------" << std::endl;
 
-	//loop through all faces stored and individually put all data 
-	//read in above into the model's internal buffer object
+	//loop through all face corners stored and only put the data of corners with a 
+	//vertex, texture coordinate and normal combination that has not been seen before 
+	//into the model's internal buffer object, so that corners shared by different 
+	//faces become one single vertex, which each corner refers to by its index
 	for (auto it = tempFaces.begin(); it != tempFaces.end(); it++)
 	{
 
+		auto key = std::make_tuple(it->X, it->Y, it->Z);
+		auto index = tempIndices.find(key);
+
+		if (index != tempIndices.end())
+		{
+			m_buffer.Indices().push_back(index->second);
+			continue;
+		}
+
+		GLuint newIndex = tempIndices.size();
+		tempIndices[key] = newIndex;
+		m_buffer.Indices().push_back(newIndex);
+
 		//add all vertex data
 		m_buffer.Vertices().push_back(tempVertices[it->X].X);
 		m_buffer.Vertices().push_back(tempVertices[it->X].Y);
@@ -322,12 +383,31 @@ bool Model::LoadFromFile(const std::string& OBJfilename, const std::string& MTLf
 
 	}
 
+	m_isPreloaded = true;
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that loads OBJ and MTL model file data based on filenames passed and fills the VBOs
+//------------------------------------------------------------------------------------------------------
+bool Model::LoadFromFile(const std::string& OBJfilename, const std::string& MTLfilename)
+{
+
+	//only read in model files if this has not already been done on a loading thread
+	if (!m_isPreloaded && !Preload(OBJfilename, MTLfilename))
+	{
+		return false;
+	}
+
 	//fill VBOs with the vertex, color, texture coordinate and normal data
 	m_buffer.FillData(Buffer::VERTEX_BUFFER);
 	m_buffer.FillData(Buffer::COLOR_BUFFER);
 	m_buffer.FillData(Buffer::TEXTURE_BUFFER);
 	m_buffer.FillData(Buffer::NORMAL_BUFFER);
 
+	m_isPreloaded = false;
+
 	return true;
 
 }
@@ -338,7 +418,7 @@ void Model::Draw()
 {
 
 	//bind texture with model based on texture ID
-	TheTexture::Instance()->Enable(m_textureID);
+	TheTexture::Instance()->Enable(TheTexture::Instance()->GetTextureID(m_texture));
 
 	//send model data to shaders
 	m_buffer.DrawData(Buffer::TRIANGLES);
@@ -346,4 +426,20 @@ void Model::Draw()
 	//unbind texture so that there are no left over links
 	TheTexture::Instance()->Disable();
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds the texture and draws all instances of the model in one draw call
+//------------------------------------------------------------------------------------------------------
+void Model::DrawInstanced()
+{
+
+	//bind texture with model based on texture ID
+	TheTexture::Instance()->Enable(TheTexture::Instance()->GetTextureID(m_texture));
+
+	//send model and instance data to shaders
+	m_buffer.DrawInstancedData(Buffer::TRIANGLES);
+
+	//unbind texture so that there are no left over links
+	TheTexture::Instance()->Disable();
+
 }
\ No newline at end of file
@@ -27,15 +27,30 @@
   function is there to be able to link the shader attribute variables with the model data via the
   internal Buffer object. The SetBufferID() function is able to link the model's internal buffer
   with the correct vertex, color and texture VBO. The SetTextureID() routine is used to assign an 
-  OpenGL texture ID to the model object. This ID is requested from the Texture Manager.
+  OpenGL texture to the model object. A handle to the texture is requested from the Texture Manager,
+  and its ID is looked up through the handle each time the model is drawn. The internal
+  buffer is interleaved, which means it stores all data in its own VBO, so the VBOs linked with 
+  SetBufferID() are not actually used.
+
+- The same model can be drawn many times over in one single draw call using the DrawInstanced()
+  routine, which is far quicker than calling Draw() for each copy with a new modelview matrix in 
+  between. Each copy, or instance, is added using the AddInstance() function with its own 
+  transformation matrix and color, and all instances are removed again with ClearInstances(). The 
+  instance data is only sent to the graphics card again when instances have been added or removed.
+  Instanced drawing needs the "INSTANCED_PROGRAM" shader program in use instead of the main one,
+  and the SetInstanceAttribute() function to link its per-instance matrix and color attributes. 
 
 - All the raw model data loading occurs in the LoadFromFile() routine, where each line of text
   in the OBJ and MTL files are read and filtered. Based on what tokens precede the lines of text,
   the function will convert and store all the values accordingly. The raw data after being sorted
   is then stored in the internal buffer's data vectors before being sent to the respective VBOs
-  to be filled. Unlike the Sprite class, all vertex data is loaded and filled once when the model
-  is loaded. Therefore in the client code the model's VBOs need to be set before the LoadFromFile()
-  function is called.
+  to be filled. Face corners that share the same vertex, texture coordinate and normal are welded
+  into one single vertex, and the faces are drawn using a list of indices into the vertices, which
+  makes for several times fewer vertices to store and process than one vertex per corner. Unlike 
+  the Sprite class, all vertex data is loaded and filled once when the model is loaded. Therefore 
+  in the client code the model's VBOs need to be set before the LoadFromFile() function is called. The reading and sorting of the files can also be done up front using the 
+  Preload() routine, which does not use OpenGL and may be called on a loading thread. When 
+  LoadFromFile() is then called on the main thread, it will only fill the VBOs.
 
 - There is a private ParseString() routine that takes in a long string of text and breaks it down
   into smaller chunks based on what token is needed to separate the text chunks. This function is
@@ -57,6 +72,7 @@
 #include <OpenGL.h>
 #include "Buffer.h"
 #include "Color.h"
+#include "Matrix4D.h"
 #include "Vector3D.h"
 #include "Vector4D.h"
 
@@ -127,17 +143,27 @@ public:
 		             const std::string& textureID, const std::string& normalID);
 	void SetShaderAttribute(const std::string& vertexAttr, const std::string& colorAttr,
 		                    const std::string& textureAttr, const std::string& normalAttr);
+	void SetInstanceAttribute(const std::string& matrixAttr, const std::string& colorAttr);
 
 public:
 
+	void AddInstance(Matrix4D& transform, const Color& color);
+	void ClearInstances();
+
+public:
+
+	bool Preload(const std::string& OBJfilename, const std::string& MTLfilename);
 	bool LoadFromFile(const std::string& OBJfilename, const std::string& MTLfilename);
 	void Draw();
+	void DrawInstanced();
 
 private:
 
+	bool m_isPreloaded;
+
 	Color m_color;
 	Buffer m_buffer;
-	GLuint m_textureID;
+	Handle m_texture;
 
 	std::map<std::string, Material*> m_materials;
 
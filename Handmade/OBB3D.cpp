@@ -299,4 +299,26 @@ bool OBB3D::IsColliding(const OBB3D* tempBoxes) const
 	//that means both boxes collide, so return true
 	return true;
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns world space box around all corners of bound
+//------------------------------------------------------------------------------------------------------
+bool OBB3D::GetExtent(Vector3D<float>& min, Vector3D<float>& max) const
+{
+
+	//the box extends as far as its furthest corner in each direction
+	min = max = Vector3D<float>(m_corners[0].X, m_corners[0].Y, m_corners[0].Z);
+
+	for (int i = 1; i < 8; i++)
+	{
+		min.X = (m_corners[i].X < min.X ? m_corners[i].X : min.X);
+		min.Y = (m_corners[i].Y < min.Y ? m_corners[i].Y : min.Y);
+		max.X = (m_corners[i].X > max.X ? m_corners[i].X : max.X);
+		max.Y = (m_corners[i].Y > max.Y ? m_corners[i].Y : max.Y);
+		min.Z = (m_corners[i].Z < min.Z ? m_corners[i].Z : min.Z);
+		max.Z = (m_corners[i].Z > max.Z ? m_corners[i].Z : max.Z);
+	}
+
+	return true;
+
 }
\ No newline at end of file
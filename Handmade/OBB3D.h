@@ -103,6 +103,7 @@ public:
 
 	virtual void Update();
 	virtual void Draw();
+	virtual bool GetExtent(Vector3D<float>& min, Vector3D<float>& max) const;
 
 private:
 
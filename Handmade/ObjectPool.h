@@ -0,0 +1,227 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This is a templatized class that encapsulates a pool of game objects of one type, designed for
+  objects that are spawned and destroyed all the time, like bullets or particles. Instead of asking
+  the heap for memory for each object, the pool allocates a whole block of slots in one go and 
+  hands those out one by one. Released slots are put on a free list and handed out again the next
+  time an object is created, so once the pool has grown big enough, creating and destroying objects
+  no longer allocates any memory at all. Blocks are never moved or freed until the pool itself is
+  destroyed, so the address of an object stays the same for as long as it lives.
+
+- The free list is stored inside the empty slots themselves, so that each free slot holds a pointer
+  to the next free slot, and no extra memory is needed to keep track of them. 
+
+- The Create() function constructs a new object in a free slot, passing along any constructor 
+  parameters, and lets the object know which pool it came from. The Release() function destroys
+  the object and puts its slot back on the free list. Release() is declared in the GameObjectPool 
+  base class, so that game states can hand back any pooled game object without knowing its type. 
+  Pooled objects should not be deleted, and should all be released before the pool is destroyed.
+
+- The Reserve() routine allocates enough blocks upfront for the amount of objects passed, so that
+  no memory is allocated during gameplay at all. The pool is not thread safe, so objects should 
+  only be created and released on the main thread.
+
+*/
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "GameObject.h"
+
+class GameObjectPool
+{
+
+public:
+
+	virtual ~GameObjectPool() {}
+
+public:
+
+	virtual void Release(GameObject* gameObject) = 0;
+
+};
+
+template <class T> class ObjectPool : public GameObjectPool
+{
+
+public:
+
+	ObjectPool(int blockSize = 64);
+	virtual ~ObjectPool();
+
+public:
+
+	int GetCapacity();
+	int GetTotalUsed();
+
+public:
+
+	template <class... Args> T* Create(Args&&... args);
+	virtual void Release(GameObject* gameObject);
+	void Reserve(int totalObjects);
+
+private:
+
+	union Slot
+	{
+		Slot* next;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type object;
+	};
+
+private:
+
+	ObjectPool(const ObjectPool&);
+	ObjectPool& operator=(const ObjectPool&);
+
+private:
+
+	void AddBlock();
+
+private:
+
+	int m_blockSize;
+	int m_totalUsed;
+
+	Slot* m_freeSlot;
+	std::vector<Slot*> m_blocks;
+
+};
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+template <class T> ObjectPool<T>::ObjectPool(int blockSize)
+{
+
+	static_assert(std::is_base_of<GameObject, T>::value, "Pooled objects must be game objects.");
+
+	m_blockSize = (blockSize > 0 ? blockSize : 1);
+	m_totalUsed = 0;
+	m_freeSlot = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//destructor that frees all blocks of slots
+//------------------------------------------------------------------------------------------------------
+template <class T> ObjectPool<T>::~ObjectPool()
+{
+
+	//any objects still in use at this point are never destroyed
+	if (m_totalUsed > 0)
+	{
+		std::cout << "Object pool destroyed with " << m_totalUsed
+			      << " object(s) still in use." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+	}
+
+	for (auto it = m_blocks.begin(); it != m_blocks.end(); it++)
+	{
+		delete [] (*it);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of objects the pool can hold without allocating
+//------------------------------------------------------------------------------------------------------
+template <class T> int ObjectPool<T>::GetCapacity()
+{
+
+	return m_blocks.size() * m_blockSize;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of objects currently in use
+//------------------------------------------------------------------------------------------------------
+template <class T> int ObjectPool<T>::GetTotalUsed()
+{
+
+	return m_totalUsed;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that constructs a new object in a free slot and returns its address
+//------------------------------------------------------------------------------------------------------
+template <class T> template <class... Args> T* ObjectPool<T>::Create(Args&&... args)
+{
+
+	//only allocate more memory once all slots are in use
+	if (!m_freeSlot)
+	{
+		AddBlock();
+	}
+
+	//take the first slot off the free list
+	Slot* slot = m_freeSlot;
+	m_freeSlot = slot->next;
+
+	//construct the object inside the slot's memory
+	T* object = new (&slot->object) T(std::forward<Args>(args)...);
+	object->SetPool(this);
+
+	m_totalUsed++;
+
+	return object;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that destroys the object passed and puts its slot back on the free list
+//------------------------------------------------------------------------------------------------------
+template <class T> void ObjectPool<T>::Release(GameObject* gameObject)
+{
+
+	//the object is destroyed but its memory stays in the pool
+	T* object = static_cast<T*>(gameObject);
+	object->~T();
+
+	Slot* slot = reinterpret_cast<Slot*>(object);
+	slot->next = m_freeSlot;
+	m_freeSlot = slot;
+
+	m_totalUsed--;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that allocates enough blocks upfront to hold the amount of objects passed
+//------------------------------------------------------------------------------------------------------
+template <class T> void ObjectPool<T>::Reserve(int totalObjects)
+{
+
+	while (GetCapacity() < totalObjects)
+	{
+		AddBlock();
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that allocates a new block of slots and adds them all to the free list
+//------------------------------------------------------------------------------------------------------
+template <class T> void ObjectPool<T>::AddBlock()
+{
+
+	Slot* block = new Slot[m_blockSize];
+	m_blocks.push_back(block);
+
+	//link the slots back to front so that they are handed out in memory order
+	for (int i = m_blockSize - 1; i >= 0; i--)
+	{
+		block[i].next = m_freeSlot;
+		m_freeSlot = &block[i];
+	}
+
+}
+
+#endif
\ No newline at end of file
@@ -3,6 +3,50 @@
 #include <math.h>
 #include "Quaternion.h"
 
+//------------------------------------------------------------------------------------------------------
+//STATIC function that performs spherical linear interpolation between two Quaternion objects
+//------------------------------------------------------------------------------------------------------
+Quaternion Quaternion::Slerp(const Quaternion& first, const Quaternion& second, double delta)
+{
+
+	Quaternion result;
+	Quaternion end = second;
+
+	double dot = first.W * second.W + first.X * second.X + first.Y * second.Y + first.Z * second.Z;
+
+	//a quaternion and its negative are the same rotation, so flip 
+	//the second one if needed to take the shortest way around
+	if (dot < 0.0)
+	{
+		end.W = -end.W;
+		end.X = -end.X;
+		end.Y = -end.Y;
+		end.Z = -end.Z;
+		dot = -dot;
+	}
+
+	double firstWeight = 1.0 - delta;
+	double secondWeight = delta;
+
+	//rotations that are almost the same are simply lerped, 
+	//because the angle between them is too small to divide by
+	if (dot < 0.9995)
+	{
+		double angle = acos(dot);
+		double sinAngle = sin(angle);
+
+		firstWeight = sin((1.0 - delta) * angle) / sinAngle;
+		secondWeight = sin(delta * angle) / sinAngle;
+	}
+
+	result.W = first.W * firstWeight + end.W * secondWeight;
+	result.X = first.X * firstWeight + end.X * secondWeight;
+	result.Y = first.Y * firstWeight + end.Y * secondWeight;
+	result.Z = first.Z * firstWeight + end.Z * secondWeight;
+
+	return result.Normalise();
+
+}
 //------------------------------------------------------------------------------------------------------
 //constructor that creates Quaternion object and makes it an identity quaternion
 //------------------------------------------------------------------------------------------------------
@@ -42,6 +42,9 @@
   return that instead of creating a new Quaternion object. This is because almost always a normalised
   version of a quaternion will be needed and used. This is not the case in the Vector classes.
 
+- The static Slerp() function performs spherical linear interpolation between two unit quaternions,
+  always taking the shortest way around, so that a rotation can be blended smoothly over time.
+
 - The Output() function is for debug purposes and displays the WXYZ values on the console window.
   Precision can be set here because sometimes displaying a very large or very small floating point 
   number will result in a number in scientific format. To overcome this the precision can be set so 
@@ -66,6 +69,10 @@ public :
 
 	enum QuaternionType { IDENTITY };
 
+public :
+
+	static Quaternion Slerp(const Quaternion& first, const Quaternion& second, double delta);
+
 public :
 
 	Quaternion(); 
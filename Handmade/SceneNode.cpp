@@ -0,0 +1,285 @@
+#include <algorithm>
+#include "SceneNode.h"
+
+std::mutex SceneNode::s_dirtyMutex;
+std::vector<SceneNode*> SceneNode::s_dirtyNodes;
+
+//------------------------------------------------------------------------------------------------------
+//static function that recalculates the world matrices of all dirty nodes and their children
+//------------------------------------------------------------------------------------------------------
+void SceneNode::UpdateAll()
+{
+
+	//sort dirty nodes so that parents are always updated before their children
+	std::sort(s_dirtyNodes.begin(), s_dirtyNodes.end(), 
+		      [](SceneNode* lhs, SceneNode* rhs) { return lhs->m_depth < rhs->m_depth; });
+
+	//nodes that have already been updated along with a dirty parent are skipped
+	for (auto it = s_dirtyNodes.begin(); it != s_dirtyNodes.end(); it++)
+	{
+		if ((*it)->m_isDirty)
+		{
+			(*it)->UpdateWorldMatrix();
+		}
+	}
+
+	s_dirtyNodes.clear();
+
+}
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+SceneNode::SceneNode()
+{
+
+	m_depth = 0;
+	m_isDirty = false;
+	m_isLocalDirty = false;
+
+	m_scale.Set(1.0f, 1.0f, 1.0f);
+
+	m_parent = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//destructor that detaches the node from its parent and children
+//------------------------------------------------------------------------------------------------------
+SceneNode::~SceneNode()
+{
+
+	if (m_parent)
+	{
+		m_parent->DetachChild(this);
+	}
+
+	//all children become root nodes
+	while (!m_children.empty())
+	{
+		DetachChild(m_children.back());
+	}
+
+	//make sure the node is not updated after it is gone
+	if (m_isDirty)
+	{
+		std::lock_guard<std::mutex> lock(s_dirtyMutex);
+		s_dirtyNodes.erase(std::remove(s_dirtyNodes.begin(), s_dirtyNodes.end(), this), 
+			               s_dirtyNodes.end());
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the parent node, or null if node is a root node
+//------------------------------------------------------------------------------------------------------
+SceneNode* SceneNode::GetParent()
+{
+
+	return m_parent;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns all child nodes
+//------------------------------------------------------------------------------------------------------
+const std::vector<SceneNode*>& SceneNode::GetChildren()
+{
+
+	return m_children;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that attaches the node passed as a child, detaching it from its old parent first
+//------------------------------------------------------------------------------------------------------
+void SceneNode::AttachChild(SceneNode* child)
+{
+
+	if (child->m_parent == this)
+	{
+		return;
+	}
+
+	if (child->m_parent)
+	{
+		child->m_parent->DetachChild(child);
+	}
+
+	child->m_parent = this;
+	child->SetDepth(m_depth + 1);
+	child->SetDirty();
+
+	m_children.push_back(child);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that detaches the child node passed, turning it into a root node
+//------------------------------------------------------------------------------------------------------
+void SceneNode::DetachChild(SceneNode* child)
+{
+
+	auto it = std::find(m_children.begin(), m_children.end(), child);
+
+	if (it == m_children.end())
+	{
+		return;
+	}
+
+	m_children.erase(it);
+
+	child->m_parent = 0;
+	child->SetDepth(0);
+	child->SetDirty();
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns position relative to parent
+//------------------------------------------------------------------------------------------------------
+const Vector3D<float>& SceneNode::GetPosition()
+{
+
+	return m_position;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns rotation relative to parent
+//------------------------------------------------------------------------------------------------------
+const Quaternion& SceneNode::GetRotation()
+{
+
+	return m_rotation;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns scale relative to parent
+//------------------------------------------------------------------------------------------------------
+const Vector3D<float>& SceneNode::GetScale()
+{
+
+	return m_scale;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns cached transformation relative to parent
+//------------------------------------------------------------------------------------------------------
+const Matrix4D& SceneNode::GetLocalMatrix()
+{
+
+	return m_localMatrix;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns cached transformation in the game world
+//------------------------------------------------------------------------------------------------------
+const Matrix4D& SceneNode::GetWorldMatrix()
+{
+
+	return m_worldMatrix;
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns position relative to parent
+//------------------------------------------------------------------------------------------------------
+void SceneNode::SetPosition(float x, float y, float z)
+{
+
+	m_position.Set(x, y, z);
+	m_isLocalDirty = true;
+	SetDirty();
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns rotation relative to parent
+//------------------------------------------------------------------------------------------------------
+void SceneNode::SetRotation(const Quaternion& rotation)
+{
+
+	m_rotation = rotation;
+	m_isLocalDirty = true;
+	SetDirty();
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that assigns scale relative to parent
+//------------------------------------------------------------------------------------------------------
+void SceneNode::SetScale(float x, float y, float z)
+{
+
+	m_scale.Set(x, y, z);
+	m_isLocalDirty = true;
+	SetDirty();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that flags node as dirty and adds it to the dirty queue if it is not in there already
+//------------------------------------------------------------------------------------------------------
+void SceneNode::SetDirty()
+{
+
+	if (!m_isDirty)
+	{
+		m_isDirty = true;
+
+		std::lock_guard<std::mutex> lock(s_dirtyMutex);
+		s_dirtyNodes.push_back(this);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that assigns the depth of the node and of all nodes below it
+//------------------------------------------------------------------------------------------------------
+void SceneNode::SetDepth(int depth)
+{
+
+	m_depth = depth;
+
+	for (auto it = m_children.begin(); it != m_children.end(); it++)
+	{
+		(*it)->SetDepth(depth + 1);
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that recalculates the world matrix of the node and of all nodes below it
+//------------------------------------------------------------------------------------------------------
+void SceneNode::UpdateWorldMatrix()
+{
+
+	//only rebuild the local matrix if position, rotation or scale changed
+	//the matrix is built in translate, rotate and then scale order
+	if (m_isLocalDirty)
+	{
+
+		Quaternion rotation = m_rotation;
+		Matrix4D scaleMatrix;
+
+		scaleMatrix[0] = m_scale.X;
+		scaleMatrix[5] = m_scale.Y;
+		scaleMatrix[10] = m_scale.Z;
+
+		m_localMatrix = Matrix4D::IDENTITY;
+		m_localMatrix[12] = m_position.X;
+		m_localMatrix[13] = m_position.Y;
+		m_localMatrix[14] = m_position.Z;
+		m_localMatrix * rotation.GetMatrix() * scaleMatrix;
+
+		m_isLocalDirty = false;
+
+	}
+
+	//the world matrix is the parent's world matrix followed by the local matrix
+	if (m_parent)
+	{
+		m_worldMatrix = m_parent->m_worldMatrix;
+		m_worldMatrix * m_localMatrix;
+	}
+
+	else
+	{
+		m_worldMatrix = m_localMatrix;
+	}
+
+	m_isDirty = false;
+
+	for (auto it = m_children.begin(); it != m_children.end(); it++)
+	{
+		(*it)->UpdateWorldMatrix();
+	}
+
+}
\ No newline at end of file
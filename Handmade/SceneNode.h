@@ -0,0 +1,113 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates a scene graph transform component, which is used to attach game objects
+  to each other, like the wheels and doors of a vehicle. Unlike the Transform class, which simply
+  keeps accumulating transformations, each node stores its local position, rotation and scale, 
+  relative to its parent node. From these it builds its local matrix, and combines that with the
+  parent's world matrix to get its own world matrix, which places it in the game world.
+
+- Both matrices are cached, and are only recalculated when something changes. Setting a node's 
+  position, rotation or scale, or attaching it to another parent, flags the node as dirty and adds
+  it to a static queue of dirty nodes. Once per frame, the Game class calls UpdateAll(), which sorts
+  the queue so that nodes closest to the root come first, and then recalculates the world matrix
+  of each dirty node and of all nodes below it in one pass. Nodes below a dirty node that are dirty
+  themselves are then already up to date by the time their turn comes, so each world matrix is only
+  calculated once. Nodes that have not moved are never visited at all, so a big hierarchy that is
+  standing still costs nothing.
+
+- The world matrix returned by GetWorldMatrix() is the one calculated in the last UpdateAll() call,
+  so it is best read after updating, for instance when the game object stores its render state.
+  Nodes can be changed from game objects updated on worker threads, as adding to the dirty queue is
+  thread safe, however a node and its parent should always be changed from the same thread. 
+
+- When a node is destroyed it is detached from its parent and all its children become root nodes.
+
+*/
+
+#ifndef SCENE_NODE_H
+#define SCENE_NODE_H
+
+#include <mutex>
+#include <vector>
+#include "Matrix4D.h"
+#include "Quaternion.h"
+#include "Vector3D.h"
+
+class SceneNode
+{
+
+public:
+
+	static void UpdateAll();
+
+public:
+
+	SceneNode();
+	~SceneNode();
+
+public:
+
+	SceneNode* GetParent();
+	const std::vector<SceneNode*>& GetChildren();
+	void AttachChild(SceneNode* child);
+	void DetachChild(SceneNode* child);
+
+public:
+
+	const Vector3D<float>& GetPosition();
+	const Quaternion& GetRotation();
+	const Vector3D<float>& GetScale();
+	const Matrix4D& GetLocalMatrix();
+	const Matrix4D& GetWorldMatrix();
+
+public:
+
+	void SetPosition(float x, float y, float z = 0);
+	void SetRotation(const Quaternion& rotation);
+	void SetScale(float x, float y, float z = 1);
+
+private:
+
+	SceneNode(const SceneNode&);
+	SceneNode& operator=(const SceneNode&);
+
+private:
+
+	void SetDirty();
+	void SetDepth(int depth);
+	void UpdateWorldMatrix();
+
+private:
+
+	static std::mutex s_dirtyMutex;
+	static std::vector<SceneNode*> s_dirtyNodes;
+
+private:
+
+	int m_depth;
+	bool m_isDirty;
+	bool m_isLocalDirty;
+
+	Vector3D<float> m_position;
+	Quaternion m_rotation;
+	Vector3D<float> m_scale;
+
+	Matrix4D m_localMatrix;
+	Matrix4D m_worldMatrix;
+
+	SceneNode* m_parent;
+	std::vector<SceneNode*> m_children;
+
+};
+
+#endif
\ No newline at end of file
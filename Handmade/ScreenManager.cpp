@@ -2,6 +2,8 @@
 #include <math.h>
 #include <OpenGL.h>
 #include "ScreenManager.h"
+#include "ShaderManager.h"
+#include "SpriteBatch.h"
 
 //------------------------------------------------------------------------------------------------------
 //constructor that assigns all default values 
@@ -12,6 +14,8 @@ ScreenManager::ScreenManager()
 	//first modelview transformation object to be loaded below 
 	Matrix4D modelView;
 
+	m_isHeadless = false;
+
 	m_width = 0;
 	m_height = 0;
 	m_pixelsPerUnit = 0;
@@ -47,6 +51,15 @@ Matrix4D& ScreenManager::ProjectionMatrix()
 
 	return m_projectionMatrix;
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns flag stating if screen runs without a window and OpenGL context
+//------------------------------------------------------------------------------------------------------
+bool ScreenManager::IsHeadless()
+{
+
+	return m_isHeadless;
+
 }
 //------------------------------------------------------------------------------------------------------
 //getter function that returns pixel scale value
@@ -74,6 +87,29 @@ Vector2D<int> ScreenManager::GetScreenSize()
 
 	return Vector2D<int>(m_width, m_height);
 
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that switches vertical syncing on or off
+//------------------------------------------------------------------------------------------------------
+bool ScreenManager::SetVSync(bool isVSync)
+{
+
+	//there is no OpenGL context in headless mode
+	if (m_isHeadless)
+	{
+		return true;
+	}
+
+	//if there was an error setting this value, display error message and return false
+	if (SDL_GL_SetSwapInterval(isVSync ? 1 : 0) == -1)
+	{
+		std::cout << "VSync could not be " << (isVSync ? "enabled." : "disabled.") << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
+
+	return true;
+
 }
 //------------------------------------------------------------------------------------------------------
 //setter function that assigns a pre-defined color value for clearing the screen
@@ -81,6 +117,12 @@ Vector2D<int> ScreenManager::GetScreenSize()
 void ScreenManager::SetClearColor(Color& color)
 {
 
+	//there is no OpenGL context in headless mode
+	if (m_isHeadless)
+	{
+		return;
+	}
+
 	glClearColor(color.R, color.G, color.B, color.A);
 
 }
@@ -90,6 +132,12 @@ void ScreenManager::SetClearColor(Color& color)
 void ScreenManager::SetViewport(int x, int y, int width, int height)
 {
 
+	//there is no OpenGL context in headless mode
+	if (m_isHeadless)
+	{
+		return;
+	}
+
 	glViewport(x, y, width, height);
 
 }
@@ -100,16 +148,20 @@ void ScreenManager::SetViewport(int x, int y, int width, int height)
 void ScreenManager::Set2DScreen(ScreenOrigin2D screenOrigin)
 {
 
+	//sprites waiting in the sprite batch need to be drawn with the old projection and blend state
+	TheSpriteBatch::Instance()->Flush();
+
 	//first reset projection matrix
 	m_projectionMatrix = Matrix4D::IDENTITY;
 
-	//disable Z-buffering because 
-	//in 2D the depth buffer isn't needed 
-	glDisable(GL_DEPTH_TEST);
-
-	//enable blending for transparency
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	//disable Z-buffering because in 2D the depth buffer isn't needed 
+	//and enable blending for transparency, unless in headless mode
+	if (!m_isHeadless)
+	{
+		glDisable(GL_DEPTH_TEST);
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
 
 	//assign specific components of matrix for 2D projection
 	m_projectionMatrix[0] = 2.0f / m_width; 
@@ -134,6 +186,9 @@ void ScreenManager::Set2DScreen(ScreenOrigin2D screenOrigin)
 		m_projectionMatrix[13] = -1.0f;
 	}
 
+	//share new projection with all shader programs
+	TheShader::Instance()->SetFrameData(m_projectionMatrix.GetMatrixArray());
+
 }
 //------------------------------------------------------------------------------------------------------
 //setter function that creates a 3D perspective projection using formula described below : 
@@ -142,16 +197,20 @@ void ScreenManager::Set2DScreen(ScreenOrigin2D screenOrigin)
 void ScreenManager::Set3DScreen(float fieldOfView, float nearClip, float farClip)
 {
 
+	//sprites waiting in the sprite batch need to be drawn with the old projection and blend state
+	TheSpriteBatch::Instance()->Flush();
+
 	//first reset projection matrix
 	m_projectionMatrix = Matrix4D::IDENTITY;
 
-	//enable Z-buffering so that 
-	//vertices are drawn in the correct order
-	glEnable(GL_DEPTH_TEST);
-
-	//enable blending for transparency
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	//enable Z-buffering so that vertices are drawn in the correct 
+	//order and enable blending for transparency, unless in headless mode
+	if (!m_isHeadless)
+	{
+		glEnable(GL_DEPTH_TEST);
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
 
 	//first convert field of view angle passed to radians 
 	//so that the tan function can use it later on
@@ -171,14 +230,37 @@ void ScreenManager::Set3DScreen(float fieldOfView, float nearClip, float farClip
 	m_projectionMatrix[14] = (2.0f * farClip * nearClip) / (nearClip - farClip);
 	m_projectionMatrix[15] = 0.0f;
 
+	//share new projection with all shader programs
+	TheShader::Instance()->SetFrameData(m_projectionMatrix.GetMatrixArray());
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that initializes the screen including the SDL, OpenGL and GLEW subsystems   
 //------------------------------------------------------------------------------------------------------
 bool ScreenManager::Initialize(const char* windowTitle, int width, int height, int pixelsPerUnit,
-	                           double context, bool compatibleContext, bool fullscreen)
+	                           double context, bool compatibleContext, bool fullscreen, bool headless)
 {
 
+	//in headless mode only the timer and event subsystems are needed and no window
+	//or OpenGL context is created, the screen size is still stored for the projections
+	if (headless)
+	{
+
+		if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) == -1)
+		{
+			std::cout << "SDL did not initialize properly." << std::endl;
+			return false;
+		}
+
+		m_isHeadless = true;
+		m_width = width;
+		m_height = height;
+		m_pixelsPerUnit = pixelsPerUnit;
+
+		return true;
+
+	}
+
 	//store OpenGL context in two separate variables 
 	//these will be used later to request a OpenGL context
 	double major;
@@ -307,6 +389,12 @@ void ScreenManager::PopMatrix()
 void ScreenManager::Update()
 {
 
+	//there is no frame buffer in headless mode
+	if (m_isHeadless)
+	{
+		return;
+	}
+
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 }
@@ -316,6 +404,12 @@ void ScreenManager::Update()
 void ScreenManager::Draw()
 {
 
+	//there is no frame buffer in headless mode
+	if (m_isHeadless)
+	{
+		return;
+	}
+
 	SDL_GL_SwapWindow(m_window);
 
 }
@@ -325,11 +419,13 @@ void ScreenManager::Draw()
 void ScreenManager::ShutDown()
 {
 
-	//free OpenGL context
-	SDL_GL_DeleteContext(m_context);
-
-	//free game screen and window
-	SDL_DestroyWindow(m_window);
+	//free OpenGL context and game screen and window 
+	//these do not exist when running in headless mode
+	if (!m_isHeadless)
+	{
+		SDL_GL_DeleteContext(m_context);
+		SDL_DestroyWindow(m_window);
+	}
 
 	//shut down all SDL sub-systems
 	SDL_Quit();
@@ -51,6 +51,10 @@
   specific functionality like Windows dialog or message boxes, because the HWND handle will always 
   reference the main SDL parent window.
 
+- The SetVSync() function switches vertical syncing on or off. It is switched on by default when
+  the screen is initialized, and is switched off by the Game class when a target frame rate is set, 
+  so that the frame rate can be limited by the Game class' frame pacer instead.
+
 - The PushMatrix() and PopMatrix() functions add push and pop functionality, respectively, to the
   modelview matrix. Therefore when parent and child objects are being transformed, multiple matrix
   transformations can exist at any one time, allowing for transformations to be "bookmarked". This
@@ -59,6 +63,12 @@
 - The Update() and Draw() routines will clear and swap the frame buffer respectively, and the ShutDown()
   function closes down the SDL and OpenGL subsystems.  
 
+- When the screen is initialized in headless mode, only the SDL timer and event subsystems are set
+  up and no window, OpenGL context or GLEW is created. The screen then acts as a null backend, where
+  all projection and modelview matrix calculations still work but nothing is sent to OpenGL. This
+  allows the game to run on machines without a graphics card. The other managers that use OpenGL
+  check the IsHeadless() flag and skip creating their resources.
+
 */
 
 #ifndef SCREEN_MANAGER_H
@@ -91,12 +101,14 @@ public:
 
 public :
 
+	bool IsHeadless();
 	int GetPixelsPerUnit();
 	HWND GetWindowHandle();
 	Vector2D<int> GetScreenSize();
 
 public :
 
+	bool SetVSync(bool isVSync);
 	void SetClearColor(Color& color);
 	void SetViewport(int x, int y, int width, int height);
 	void Set2DScreen(ScreenOrigin2D screenOrigin);
@@ -105,7 +117,8 @@ public :
 public:
 
 	bool Initialize(const char* windowTitle, int width = 1024, int height = 768, int pixelsPerUnit = 0,
-		            double context = 3.2, bool compatibleContext = true, bool fullscreen = false);
+		            double context = 3.2, bool compatibleContext = true, bool fullscreen = false,
+		            bool headless = false);
 
 	void PushMatrix();
 	void PopMatrix();
@@ -123,6 +136,8 @@ private:
 
 private :
 
+	bool m_isHeadless;
+
 	int m_width;
 	int m_height;
 	int m_pixelsPerUnit;
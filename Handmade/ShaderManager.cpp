@@ -1,6 +1,14 @@
+#include <cstring>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+#include "ScreenManager.h"
 #include "ShaderManager.h"
+#include "SpriteBatch.h"
+#include "StateCache.h"
 
 //------------------------------------------------------------------------------------------------------
 //constructor that assigns all default values 
@@ -9,6 +17,10 @@ ShaderManager::ShaderManager()
 {
 
 	m_program = 0;
+	m_activeProgram = 0;
+
+	m_frameBufferID = 0;
+	memset(m_frameData, 0, sizeof(m_frameData));
 	
 }
 //------------------------------------------------------------------------------------------------------
@@ -17,7 +29,32 @@ ShaderManager::ShaderManager()
 GLint ShaderManager::GetUniform(const std::string& name)
 {
 
-	return glGetUniformLocation(m_program, name.c_str());
+	if (!m_activeProgram)
+	{
+		return -1;
+	}
+
+	//use the uniform ID stored when the program was linked
+	auto it = m_activeProgram->uniforms.find(name);
+	return (it != m_activeProgram->uniforms.end() ? it->second : -1);
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the ID of the modelview matrix uniform of the active program
+//------------------------------------------------------------------------------------------------------
+GLint ShaderManager::GetModelviewUniform()
+{
+
+	return (m_activeProgram ? m_activeProgram->modelviewUniformID : -1);
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the ID of the texture offset uniform of the active program
+//------------------------------------------------------------------------------------------------------
+GLint ShaderManager::GetTextureOffsetUniform()
+{
+
+	return (m_activeProgram ? m_activeProgram->textureOffsetUniformID : -1);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -26,7 +63,23 @@ GLint ShaderManager::GetUniform(const std::string& name)
 GLint ShaderManager::GetAttribute(const std::string& name)
 {
 
-	return glGetAttribLocation(m_program, name.c_str());
+	if (!m_activeProgram)
+	{
+		return -1;
+	}
+
+	//use the attribute ID stored when the program was linked
+	auto it = m_activeProgram->attributes.find(name);
+	return (it != m_activeProgram->attributes.end() ? it->second : -1);
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the name of the shader program currently in use
+//------------------------------------------------------------------------------------------------------
+const std::string& ShaderManager::GetProgramName()
+{
+
+	return m_programName;
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -37,6 +90,49 @@ void ShaderManager::SetUniform(GLint attributeID, GLfloat* data)
 
 	glUniformMatrix4fv(attributeID, 1, GL_FALSE, data);
 
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that sends two values to a shader uniform variable based on ID passed
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::SetUniform(GLint attributeID, GLfloat x, GLfloat y)
+{
+
+	glUniform2f(attributeID, x, y);
+
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that sends the data shared by all shader programs to the uniform buffer
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::SetFrameData(GLfloat* projectionMatrix)
+{
+
+	//there is no OpenGL context to create buffers with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	//create the uniform buffer the first time round and bind it to the 
+	//binding point that all programs' "FrameData" uniform blocks read from
+	if (!m_frameBufferID)
+	{
+		glGenBuffers(1, &m_frameBufferID);
+		glBindBuffer(GL_UNIFORM_BUFFER, m_frameBufferID);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(m_frameData), m_frameData, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_DATA_BINDING, m_frameBufferID);
+	}
+
+	//only send the data to the graphics card if it has changed
+	else if (memcmp(m_frameData, projectionMatrix, sizeof(m_frameData)) == 0)
+	{
+		return;
+	}
+
+	memcpy(m_frameData, projectionMatrix, sizeof(m_frameData));
+
+	glBindBuffer(GL_UNIFORM_BUFFER, m_frameBufferID);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(m_frameData), m_frameData);
+
 }
 //------------------------------------------------------------------------------------------------------
 //setter function that links data to a shader attribute variable based on ID passed
@@ -48,42 +144,49 @@ void ShaderManager::SetAttribute(GLint attributeID, GLint componentSize)
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that will activate shader attribute variable based on ID passed
+//setter function that links shader attribute with part of an interleaved VBO
 //------------------------------------------------------------------------------------------------------
-void ShaderManager::EnableAttribute(GLint attributeID)
+void ShaderManager::SetAttribute(GLint attributeID, GLint componentSize, GLsizei stride, GLuint offset)
 {
 
-	glEnableVertexAttribArray(attributeID);
+	glVertexAttribPointer(attributeID, componentSize, GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(size_t)offset);
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that will de-activate shader attribute variable based on ID passed
+//setter function that links shader attribute with a packed RGBA color in an interleaved VBO
 //------------------------------------------------------------------------------------------------------
-void ShaderManager::DisableAttribute(GLint attributeID)
+void ShaderManager::SetPackedAttribute(GLint attributeID, GLsizei stride, GLuint offset)
 {
 
-	glDisableVertexAttribArray(attributeID);
+	glVertexAttribPointer(attributeID, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (const GLvoid*)(size_t)offset);
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that creates the main shader program
+//setter function that sets how many instances are drawn before a shader attribute moves on
 //------------------------------------------------------------------------------------------------------
-bool ShaderManager::Initialize()
+void ShaderManager::SetAttributeDivisor(GLint attributeID, GLuint divisor)
 {
 
-	//create main shader program object
-	m_program = glCreateProgram();
+	glVertexAttribDivisor(attributeID, divisor);
 
-	//if an error occured a large unsigned int will be returned 
-	//which is converted into a -1 in signed int terms
-	if (m_program == -1)
-	{
-		std::cout << "Shader program could not be created." << std::endl;
-		return false;
-	}
+}
+//------------------------------------------------------------------------------------------------------
+//function that will activate shader attribute variable based on ID passed
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::EnableAttribute(GLint attributeID)
+{
+
+	TheStateCache::Instance()->EnableAttribute(attributeID);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that will de-activate shader attribute variable based on ID passed
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::DisableAttribute(GLint attributeID)
+{
+
+	TheStateCache::Instance()->DisableAttribute(attributeID);
 
-	return true;
-	
 }
 //------------------------------------------------------------------------------------------------------
 //function that creates a vertex, fragment or geometry shader object
@@ -97,7 +200,13 @@ bool ShaderManager::Create(ShaderType shaderType, const std::string& mapIndex)
 	//temp flag and storage map which will reference specific shader 
 	//creation value and point to specific map that the ID will be stored in. 
 	GLenum tempFlag = 0;
-	std::map<std::string, GLuint>* tempMap = 0;
+	std::map<std::string, Handle>* tempMap = 0;
+
+	//there is no OpenGL context to create shaders with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
 
 	//based on enum type passed assign correct OpenGL flag and storage 
 	//map so that when the shader ID is generated and stored the correct 
@@ -140,53 +249,469 @@ bool ShaderManager::Create(ShaderType shaderType, const std::string& mapIndex)
 		return false;
 	}
 
-	//store ID in specific map
-	(*tempMap)[mapIndex] = ID;
+	//if a shader already exists under the same name, destroy it first
+	Destroy(shaderType, CUSTOM_SHADER, mapIndex);
+
+	//store ID in slot map and its handle in specific map
+	(*tempMap)[mapIndex] = m_shaderIDs.Add(ID);
 
 	return true;
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that attaches a vertex, fragment or geometry shader object to the main shader program 
+//function that reads in and preprocesses the shader source code so that it can be compiled later
 //------------------------------------------------------------------------------------------------------
-void ShaderManager::Attach(ShaderType shaderType, const std::string& mapIndex)
+bool ShaderManager::Compile(ShaderType shaderType, const std::string& filename, 
+	                        const std::string& mapIndex, int features)
 {
 
-	//temp pointer which will reference specific shader ID map
-	std::map<std::string, GLuint>* tempMap = 0;
+	//temp shader ID storage
+	GLuint tempShaderID;
 
-	//based on which shader needs to be attached point to specific 
-	//storage map so that when attaching later there is no duplicate code
-	switch (shaderType)
+	//there is no OpenGL context to compile shaders with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
+
+	//find shader ID in specific storage map so 
+	//that when compiling later there is no duplicate code
+	tempShaderID = GetShaderID(shaderType, mapIndex);
+
+	if (!tempShaderID)
+	{
+		return false;
+	}
+
+	//each combination of file and features is only read in and preprocessed 
+	//once, no matter how many shaders are created from it
+	std::string key = filename + "|" + std::to_string(features);
+	auto it = m_variants.find(key);
+
+	if (it == m_variants.end())
+	{
+
+		std::string sourceCode;
+
+		//display text to state that file is being opened and read
+		std::cout << "Opening and reading " 
+			      << (shaderType == VERTEX_SHADER ? "vertex" : 
+			          shaderType == FRAGMENT_SHADER ? "fragment" : "geometry") << " shader file : " 
+			      << "\"" << filename << "\"" << std::endl;
+
+		if (!Preprocess(filename, sourceCode, 0))
+		{
+			return false;
+		}
+
+		AddFeatures(sourceCode, features);
+		it = m_variants.insert(std::make_pair(key, sourceCode)).first;
+
+		std::cout << "Shader file read successfully." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+
+	}
+
+	//if another shader was already created from the same variant, let this one share its
+	//shader object instead, so that the same source code is never compiled more than once
+	auto shared = m_variantShaders.find(key);
+
+	if (shared != m_variantShaders.end())
+	{
+
+		if (shared->second != tempShaderID)
+		{
+			Release(tempShaderID);
+			*m_shaderIDs.Get((*GetHandleMap(shaderType))[mapIndex]) = shared->second;
+			m_shaderSources[shared->second].totalUsers++;
+		}
+
+		return true;
+
+	}
+
+	//a shader that already holds another variant may be shared with other 
+	//names, so it is let go of and this one gets a shader object of its own
+	if (m_shaderSources.find(tempShaderID) != m_shaderSources.end())
+	{
+
+		GLint type = 0;
+		glGetShaderiv(tempShaderID, GL_SHADER_TYPE, &type);
+		Release(tempShaderID);
+
+		tempShaderID = glCreateShader(type);
+		*m_shaderIDs.Get((*GetHandleMap(shaderType))[mapIndex]) = tempShaderID;
+
+	}
+
+	//store the source code without compiling it yet, because if the program that uses 
+	//the shader can be loaded from the binary cache it never needs to be compiled at all
+	Source& source = m_shaderSources[tempShaderID];
+	source.code = it->second;
+	source.variant = key;
+	source.isCompiled = false;
+	source.totalUsers = 1;
+
+	m_variantShaders[key] = tempShaderID;
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates and links a shader program from the shaders passed, unless already done
+//------------------------------------------------------------------------------------------------------
+bool ShaderManager::CreateProgram(const std::string& programName, const std::string& vertexShader,
+	                              const std::string& fragmentShader, const std::string& geometryShader)
+{
+
+	//there is no OpenGL context to create programs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
+
+	//the combination of shaders is what makes a program unique, so if a program 
+	//with the same name and shaders has already been linked, simply use that one
+	std::string key = vertexShader + "," + fragmentShader + "," + geometryShader;
+	auto it = m_programs.find(programName);
+
+	if (it != m_programs.end())
+	{
+
+		if (it->second.key == key)
+		{
+			return true;
+		}
+
+		DestroyProgram(programName);
+
+	}
+
+	//find all shader IDs, the geometry shader is optional
+	GLuint shaderIDs[] = { GetShaderID(VERTEX_SHADER, vertexShader), 
+		                   GetShaderID(FRAGMENT_SHADER, fragmentShader),
+		                   (geometryShader.empty() ? 0 : GetShaderID(GEOMETRY_SHADER, geometryShader)) };
+
+	const int TOTAL_SHADERS = (geometryShader.empty() ? 2 : 3);
+
+	for (int i = 0; i < TOTAL_SHADERS; i++)
+	{
+		if (!shaderIDs[i])
+		{
+			return false;
+		}
+	}
+
+	//create shader program object
+	GLuint programID = glCreateProgram();
+
+	if (!programID)
+	{
+		std::cout << "Shader program \"" << programName << "\" could not be created." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
+
+	//first try to load the program from an earlier run, which is far quicker than compiling 
+	//and linking, and only if there is none or the driver rejects it build it from source
+	std::string filename = GetBinaryFilename(shaderIDs, TOTAL_SHADERS);
+	bool isLinked = LoadBinary(programID, filename);
+
+	if (!isLinked)
+	{
+
+		//compile all shaders that have not been compiled yet
+		for (int i = 0; i < TOTAL_SHADERS; i++)
+		{
+			if (!CompileShader(shaderIDs[i]))
+			{
+				glDeleteProgram(programID);
+				return false;
+			}
+		}
+
+		//let the driver know that the linked program will be saved to file
+		if (GLEW_ARB_get_program_binary)
+		{
+			glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+
+		//attach all shaders, link them into one program and detach them again
+		//because the linked program no longer needs them
+		for (int i = 0; i < TOTAL_SHADERS; i++)
+		{
+			glAttachShader(programID, shaderIDs[i]);
+		}
+
+		isLinked = Link(programID);
+
+		for (int i = 0; i < TOTAL_SHADERS; i++)
+		{
+			glDetachShader(programID, shaderIDs[i]);
+		}
+
+		if (isLinked)
+		{
+			SaveBinary(programID, filename);
+		}
+
+	}
+
+	if (!isLinked)
+	{
+		glDeleteProgram(programID);
+		return false;
+	}
+
+	Program& program = m_programs[programName];
+	program.ID = programID;
+	program.key = key;
+	Reflect(program);
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that activates a shader program based on name passed
+//------------------------------------------------------------------------------------------------------
+bool ShaderManager::UseProgram(const std::string& programName)
+{
+
+	//there is no OpenGL context to use programs with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
+
+	auto it = m_programs.find(programName);
+
+	if (it == m_programs.end())
+	{
+		std::cout << "Shader program \"" << programName << "\" does not exist." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
+
+	//sprites waiting in the sprite batch belong to the current program
+	if (it->second.ID != m_program)
+	{
+		TheSpriteBatch::Instance()->Flush();
+		m_program = it->second.ID;
+		m_activeProgram = &it->second;
+		m_programName = programName;
+	}
+
+	TheStateCache::Instance()->UseProgram(m_program);
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that destroys a shader program based on name passed
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::DestroyProgram(const std::string& programName)
+{
+
+	auto it = m_programs.find(programName);
+
+	if (it == m_programs.end())
+	{
+		return;
+	}
+
+	if (it->second.ID == m_program)
+	{
+		m_program = 0;
+		m_activeProgram = 0;
+		m_programName.clear();
+	}
+
+	glDeleteProgram(it->second.ID);
+	TheStateCache::Instance()->ForgetProgram(it->second.ID);
+	m_programs.erase(it);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that unloads a single or multiple shader IDs from memory
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::Destroy(ShaderType shaderType, RemoveType removeType, const std::string& mapIndex)
+{
+
+	//there is no OpenGL context to destroy shaders with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return;
+	}
+
+	//temp pointer which will reference specific shader handle map
+	//so that the pointer is used instead of three different maps
+	std::map<std::string, Handle>* tempMap = GetHandleMap(shaderType);
+
+	//loop through entire shader ID map in order 
+	//to remove a specific shader ID or all shader IDs
+	for (auto it = tempMap->begin(); it != tempMap->end(); it++)
+	{
+
+		//if a flag is passed to remove a specific shader ID
+		//check if map index is the shader that needs to be removed
+		//and remove it from both OpenGL and the map
+		if (removeType == CUSTOM_SHADER)
+		{
+			if (it->first == mapIndex)
+			{
+				Release(*m_shaderIDs.Get(it->second));
+				m_shaderIDs.Remove(it->second);
+				tempMap->erase(it);
+				break;
+			}
+		}
+
+		//otherwise if a flag is passed to remove all shader IDs
+		//remove the shader from OpenGL and the slot map
+		else if (removeType == ALL_SHADERS)
+		{
+			Release(*m_shaderIDs.Get(it->second));
+			m_shaderIDs.Remove(it->second);
+		}
+
+	}
+
+	//if all shader IDs have been removed from OpenGL, clear the 
+	//entire map in one go, because the IDs in the map still remain
+	if (removeType == ALL_SHADERS)
+	{
+		tempMap->clear();
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that destroys shader program 
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::ShutDown()
+{
+
+	for (auto it = m_programs.begin(); it != m_programs.end(); it++)
+	{
+		glDeleteProgram(it->second.ID);
+		TheStateCache::Instance()->ForgetProgram(it->second.ID);
+	}
+
+	//release every shader that is still around, which deletes each 
+	//shader object once, no matter how many names share it
+	Destroy(VERTEX_SHADER, ALL_SHADERS);
+	Destroy(FRAGMENT_SHADER, ALL_SHADERS);
+	Destroy(GEOMETRY_SHADER, ALL_SHADERS);
+
+	m_programs.clear();
+	m_variants.clear();
+	m_variantShaders.clear();
+	m_shaderSources.clear();
+	m_shaderIDs.Clear();
+	m_program = 0;
+	m_activeProgram = 0;
+	m_programName.clear();
+
+	glDeleteBuffers(1, &m_frameBufferID);
+	m_frameBufferID = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that returns the ID of a shader found in the specific map or 0 if it does not exist
+//------------------------------------------------------------------------------------------------------
+GLuint ShaderManager::GetShaderID(ShaderType shaderType, const std::string& mapIndex)
+{
+
+	std::map<std::string, Handle>* tempMap = GetHandleMap(shaderType);
+	auto it = tempMap->find(mapIndex);
+
+	if (it == tempMap->end())
+	{
+		std::cout << "Shader \"" << mapIndex << "\" does not exist." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return 0;
+	}
+
+	return *m_shaderIDs.Get(it->second);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that lets go of a shader object and destroys it once no shader name uses it anymore
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::Release(GLuint shaderID)
+{
+
+	auto it = m_shaderSources.find(shaderID);
+
+	//shader objects that were never compiled belong to one name only
+	if (it != m_shaderSources.end())
+	{
+
+		if (--it->second.totalUsers > 0)
+		{
+			return;
+		}
+
+		m_variantShaders.erase(it->second.variant);
+		m_shaderSources.erase(it);
+
+	}
+
+	glDeleteShader(shaderID);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that links shader program with all its attached shaders
+//------------------------------------------------------------------------------------------------------
+bool ShaderManager::Link(GLuint programID)
+{
+
+	//variable to store link error code
+	GLint linkResult = 0;
+
+	//link entire shader program with all its shader objects
+	glLinkProgram(programID);
+
+	//request linking error code for error checking
+	glGetProgramiv(programID, GL_LINK_STATUS, &linkResult);
+
+	//if linking failed, request error string and store 
+	//in an array of a set size, and display the error on screen
+	if (linkResult == GL_FALSE)
 	{
-		case VERTEX_SHADER   : tempMap = &m_vertexShaderIDMap; break;
-		case FRAGMENT_SHADER : tempMap = &m_fragmentShaderIDMap; break;
-		case GEOMETRY_SHADER : tempMap = &m_geometryShaderIDMap; break;
+		GLchar error[1000];
+		GLsizei length = 1000;
+
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		std::cout << "Linking : FAIL" << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+
+		glGetProgramInfoLog(programID, 1000, &length, error);
+		std::cout << error << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+
+		return false;
 	}
 
-	//attach shader object using specific storage map
-	glAttachShader(m_program, (*tempMap)[mapIndex]);
+	return true;
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that reads in the shader source code and compiles it
+//function that reads in a shader file and replaces all of its #include lines with the files named
 //------------------------------------------------------------------------------------------------------
-bool ShaderManager::Compile(ShaderType shaderType, 
-	                        const std::string& filename, const std::string& mapIndex)
+bool ShaderManager::Preprocess(const std::string& filename, std::string& sourceCode, int depth)
 {
 
-	//variables for file handling, source code 
-	//text reading and storing and temp shader ID storage
+	//variables for file handling and source code text reading
 	std::fstream file;
-	std::string lineText = "";
-	std::string finalString;
-	GLint tempShaderID;
-	GLint compileResult;
+	std::stringstream fileText;
 
-	//display text to state that file is being opened and read
-	std::cout << "Opening and reading " 
-		      << (shaderType == VERTEX_SHADER ? "vertex" : "fragment") << " shader file : " 
-		      << "\"" << filename << "\"" << std::endl;
+	//files that include each other would otherwise never stop
+	if (depth > MAX_INCLUDE_DEPTH)
+	{
+		std::cout << "Shader file \"" << filename << "\" is included too deeply." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
 
 	//open shader file
 	file.open(filename);
@@ -194,46 +719,137 @@ bool ShaderManager::Compile(ShaderType shaderType,
 	//if file has an error opening output error message
 	if (!file)
 	{
-		std::cout << "File could not be loaded." << std::endl;
+		std::cout << "File \"" << filename << "\" could not be loaded." << std::endl;
 		std::cout << "---------------------------------------------------------------" << std::endl;
 		return false;
 	}
 
-	//based on which shader needs to be compiled point to specific 
-	//shader ID so that when compiling later there is no duplicate code
-	switch (shaderType)
+	//included files are found relative to the folder of the file including them
+	std::string folder = filename.substr(0, filename.find_last_of("\\/") + 1);
+
+	//read the entire file in one go into one big string
+	fileText << file.rdbuf();
+	const std::string text = fileText.str();
+
+	//close the file 
+	file.close();
+
+	//scan the text line by line and copy it over in one go up 
+	//to each #include line, which is replaced by the file named
+	size_t copyStart = 0;
+	size_t lineStart = 0;
+
+	while (lineStart < text.size())
+	{
+
+		size_t lineEnd = text.find('\n', lineStart);
+		lineEnd = (lineEnd == std::string::npos ? text.size() : lineEnd);
+
+		size_t start = text.find_first_not_of(" \t", lineStart);
+
+		if (start < lineEnd && text.compare(start, 8, "#include") == 0)
+		{
+
+			size_t first = text.find('"', start);
+			size_t last = (first < lineEnd ? text.find('"', first + 1) : std::string::npos);
+
+			if (last >= lineEnd)
+			{
+				std::cout << "Invalid #include line in shader file \"" << filename << "\"." << std::endl;
+				std::cout << "---------------------------------------------------------------" << std::endl;
+				return false;
+			}
+
+			sourceCode.append(text, copyStart, lineStart - copyStart);
+
+			if (!Preprocess(folder + text.substr(first + 1, last - first - 1), sourceCode, depth + 1))
+			{
+				return false;
+			}
+
+			copyStart = lineEnd + 1;
+
+		}
+
+		lineStart = lineEnd + 1;
+
+	}
+
+	if (copyStart < text.size())
 	{
-		case VERTEX_SHADER   : tempShaderID = m_vertexShaderIDMap[mapIndex]; break;
-		case FRAGMENT_SHADER : tempShaderID = m_fragmentShaderIDMap[mapIndex]; break;
-		case GEOMETRY_SHADER : tempShaderID = m_geometryShaderIDMap[mapIndex]; break;
+		sourceCode.append(text, copyStart, std::string::npos);
 	}
 
-	//read through the entire file and add each line of code into a big string
-	//the newline character needs to be added to the end of each code line
-	while (!file.eof())
+	//make sure the code that follows an included file starts on a new line
+	if (!sourceCode.empty() && sourceCode.back() != '\n')
 	{
-		getline(file, lineText);
-		finalString += lineText + "\n";
+		sourceCode += "\n";
 	}
 
-	//close the file 
-	file.close();
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that adds a #define for each feature passed to the shader source code
+//------------------------------------------------------------------------------------------------------
+void ShaderManager::AddFeatures(std::string& sourceCode, int features)
+{
+
+	std::string defines;
+
+	if (features & TEXTURED)     defines += "#define TEXTURED\n";
+	if (features & INSTANCED)    defines += "#define INSTANCED\n";
+	if (features & VERTEX_COLOR) defines += "#define VERTEX_COLOR\n";
+
+	//the #version line has to stay first, so the defines are added right after it
+	size_t position = 0;
+
+	if (sourceCode.compare(0, 8, "#version") == 0)
+	{
+		position = sourceCode.find('\n') + 1;
+	}
+
+	sourceCode.insert(position, defines);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that compiles the stored source code of the shader passed, unless already done
+//------------------------------------------------------------------------------------------------------
+bool ShaderManager::CompileShader(GLuint shaderID)
+{
+
+	//variable to store compile error code
+	GLint compileResult = 0;
+
+	auto it = m_shaderSources.find(shaderID);
+
+	if (it == m_shaderSources.end())
+	{
+		std::cout << "Shader has no source code to compile." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
+
+	if (it->second.isCompiled)
+	{
+		return true;
+	}
 
 	//convert final code string into a char array 
 	//because OpenGL requires this format for compilation 
-	const GLchar* finalCode = static_cast<const GLchar*>(finalString.c_str());
+	const GLchar* finalCode = static_cast<const GLchar*>(it->second.code.c_str());
 
 	//debug output of long shader source code
 	std::cout << "Compiling shader file..." << std::endl;
 	
 	//bind shader object with the shader source code
-	glShaderSource(tempShaderID, 1, &finalCode, NULL);
+	glShaderSource(shaderID, 1, &finalCode, NULL);
 
 	//compile the source code using the shader object
-	glCompileShader(tempShaderID);
+	glCompileShader(shaderID);
 
 	//request compilation error code for error checking
-	glGetShaderiv(tempShaderID, GL_COMPILE_STATUS, &compileResult);
+	glGetShaderiv(shaderID, GL_COMPILE_STATUS, &compileResult);
 
 	//if compilation went well, display a friendly message
 	if (compileResult == GL_TRUE)
@@ -252,142 +868,216 @@ bool ShaderManager::Compile(ShaderType shaderType,
 		std::cout << "Shader file could not be compiled. See error list below." << std::endl;
 		std::cout << "---------------------------------------------------------------" << std::endl;
 
-		glGetShaderInfoLog(tempShaderID, 1000, &length, error);
+		glGetShaderInfoLog(shaderID, 1000, &length, error);
 		std::cout << error << std::endl;
 		std::cout << "---------------------------------------------------------------" << std::endl;
 
 		return false;
 	}
 
+	it->second.isCompiled = true;
+
 	return true;
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that links entire program together
+//function that creates a unique program binary filename from all shader code and the graphics driver
 //------------------------------------------------------------------------------------------------------
-bool ShaderManager::Link()
+std::string ShaderManager::GetBinaryFilename(const GLuint* shaderIDs, int totalShaders)
 {
 
-	//variable to store link error code
+	//the driver decides the format of the binary, so the graphics 
+	//card and driver version are part of the key as well
+	std::string key = (const char*)(glGetString(GL_VENDOR));
+	key += (const char*)(glGetString(GL_RENDERER));
+	key += (const char*)(glGetString(GL_VERSION));
+
+	for (int i = 0; i < totalShaders; i++)
+	{
+		key += m_shaderSources[shaderIDs[i]].code;
+	}
+
+	//create a 64-bit FNV-1a hash of the entire key
+	unsigned long long hash = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < key.size(); i++)
+	{
+		hash ^= (unsigned char)key[i];
+		hash *= 1099511628211ULL;
+	}
+
+	std::stringstream filename;
+	filename << "Shaders\\Program_" << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+
+	return filename.str();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that loads a linked program from a binary file, if the driver accepts it
+//------------------------------------------------------------------------------------------------------
+bool ShaderManager::LoadBinary(GLuint programID, const std::string& filename)
+{
+
+	GLint totalFormats = 0;
 	GLint linkResult = 0;
+	GLenum format = 0;
 
-	//link entire shader program with all its shader objects
-	glLinkProgram(m_program);
+	//not all drivers can load program binaries
+	if (!GLEW_ARB_get_program_binary)
+	{
+		return false;
+	}
 
-	//activate main shader program
-	glUseProgram(m_program);
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &totalFormats);
 
-	//request linking error code for error checking
-	glGetProgramiv(m_program, GL_LINK_STATUS, &linkResult);
+	if (totalFormats == 0)
+	{
+		return false;
+	}
 
-	//there is no check for link success because when linking is performed 
-	//multiple times, that will display too many messages on the console screen
+	//if the program has not been saved before, there is nothing to load
+	std::fstream file(filename, std::ios_base::in | std::ios_base::binary);
 
-	//if linking failed, request error string and store 
-	//in an array of a set size, and display the error on screen
-	if (linkResult == GL_FALSE)
+	if (!file)
 	{
-		GLchar error[1000];
-		GLsizei length = 1000;
+		return false;
+	}
 
-		std::cout << "---------------------------------------------------------------" << std::endl;
-		std::cout << "Linking : FAIL" << std::endl;
-		std::cout << "---------------------------------------------------------------" << std::endl;
+	//the file starts with the binary format followed by the binary itself
+	file.read((char*)&format, sizeof(format));
+	std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	file.close();
 
-		glGetProgramInfoLog(m_program, 1000, &length, error);
-		std::cout << error << std::endl;
-		std::cout << "---------------------------------------------------------------" << std::endl;
+	if (binary.empty())
+	{
+		return false;
+	}
+
+	glProgramBinary(programID, format, &binary[0], binary.size());
 
+	//a driver update may make older binaries invalid, in 
+	//which case the program is built from source instead
+	glGetProgramiv(programID, GL_LINK_STATUS, &linkResult);
+
+	if (linkResult == GL_FALSE)
+	{
+		std::cout << "Program binary file \"" << filename << "\" rejected, compiling shaders instead." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
 		return false;
 	}
 
+	std::cout << "Program binary file \"" << filename << "\" loaded successfully." << std::endl;
+	std::cout << "---------------------------------------------------------------" << std::endl;
+
 	return true;
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that detaches a vertex, fragment or geometry shader object from the main shader program
+//function that saves a linked program to a binary file so that it can be loaded on the next run
 //------------------------------------------------------------------------------------------------------
-void ShaderManager::Detach(ShaderType shaderType, const std::string& mapIndex)
+void ShaderManager::SaveBinary(GLuint programID, const std::string& filename)
 {
 
-	//temp pointer which will reference specific shader ID map
-	std::map<std::string, GLuint>* tempMap = 0;
+	GLint length = 0;
+	GLenum format = 0;
 
-	//based on which shader needs to be detached point to specific 
-	//storage map so that when detaching later there is no duplicate code
-	switch (shaderType)
+	if (!GLEW_ARB_get_program_binary)
+	{
+		return;
+	}
+
+	glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if (length <= 0)
+	{
+		return;
+	}
+
+	std::vector<char> binary(length);
+	glGetProgramBinary(programID, length, 0, &format, &binary[0]);
+
+	std::fstream file(filename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+	//failing to save the binary only means that the program is built from source next time
+	if (!file)
 	{
-		case VERTEX_SHADER   : tempMap = &m_vertexShaderIDMap; break;
-		case FRAGMENT_SHADER : tempMap = &m_fragmentShaderIDMap; break;
-		case GEOMETRY_SHADER : tempMap = &m_geometryShaderIDMap; break;
+		std::cout << "Program binary file \"" << filename << "\" could not be saved." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return;
 	}
 
-	//detach shader object using specific storage map
-	glDetachShader(m_program, (*tempMap)[mapIndex]);
+	file.write((const char*)&format, sizeof(format));
+	file.write(&binary[0], length);
+	file.close();
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that unloads a single or multiple shader IDs from memory
+//function that stores the IDs of all uniform and attribute variables used in the program passed
 //------------------------------------------------------------------------------------------------------
-void ShaderManager::Destroy(ShaderType shaderType, RemoveType removeType, const std::string& mapIndex)
+void ShaderManager::Reflect(Program& program)
 {
 
-	//temp pointer which will reference specific shader ID map
-	std::map<std::string, GLuint>* tempMap = 0;
+	GLint total = 0;
+	GLint size = 0;
+	GLenum type = 0;
+	GLchar name[256];
 
-	//assign whichever shader ID map needs to be removed from 
-	//to temp pointer so that when looping through the map later, 
-	//the pointer is used instead of looping through three different maps
-	switch (shaderType)
-	{
-		case VERTEX_SHADER   : tempMap = &m_vertexShaderIDMap; break;
-		case FRAGMENT_SHADER : tempMap = &m_fragmentShaderIDMap; break;
-		case GEOMETRY_SHADER : tempMap = &m_geometryShaderIDMap; break;
-	}
+	//store ID of each uniform variable, except for those inside a uniform block 
+	//because they have no ID of their own and are set through the uniform buffer
+	glGetProgramiv(program.ID, GL_ACTIVE_UNIFORMS, &total);
 
-	//loop through entire shader ID map in order 
-	//to remove a specific shader ID or all shader IDs
-	for (auto it = tempMap->begin(); it != tempMap->end(); it++)
+	for (GLint i = 0; i < total; i++)
 	{
 
-		//if a flag is passed to remove a specific shader ID
-		//check if map index is the shader that needs to be removed
-		//and remove it from both OpenGL and the map
-		if (removeType == CUSTOM_SHADER)
-		{
-			if (it->first == mapIndex)
-			{
-				glDeleteShader(it->second);
-				tempMap->erase(it);
-				break;
-			}
-		}
+		glGetActiveUniform(program.ID, i, sizeof(name), 0, &size, &type, name);
+		GLint ID = glGetUniformLocation(program.ID, name);
 
-		//otherwise if a flag is passed to remove all shader IDs
-		//remove the shader from OpenGL
-		else if (removeType == ALL_SHADERS)
+		if (ID != -1)
 		{
-			glDeleteShader(it->second);
+			program.uniforms[name] = ID;
 		}
 
 	}
 
-	//if all shader IDs have been removed from OpenGL, clear the 
-	//entire map in one go, because the IDs in the map still remain
-	if (removeType == ALL_SHADERS)
+	//store ID of each attribute variable
+	glGetProgramiv(program.ID, GL_ACTIVE_ATTRIBUTES, &total);
+
+	for (GLint i = 0; i < total; i++)
 	{
-		tempMap->clear();
+		glGetActiveAttrib(program.ID, i, sizeof(name), 0, &size, &type, name);
+		program.attributes[name] = glGetAttribLocation(program.ID, name);
+	}
+
+	//store the uniforms set for every object drawn separately so that they need no lookup
+	auto it = program.uniforms.find("modelviewMatrix");
+	program.modelviewUniformID = (it != program.uniforms.end() ? it->second : -1);
+
+	it = program.uniforms.find("textureOffset");
+	program.textureOffsetUniformID = (it != program.uniforms.end() ? it->second : -1);
+
+	//link the program's shared data block to the uniform buffer, if it uses it
+	GLuint blockIndex = glGetUniformBlockIndex(program.ID, "FrameData");
+
+	if (blockIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(program.ID, blockIndex, FRAME_DATA_BINDING);
 	}
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that destroys shader program 
+//function that returns the handle map of the shader type passed
 //------------------------------------------------------------------------------------------------------
-void ShaderManager::ShutDown()
+std::map<std::string, Handle>* ShaderManager::GetHandleMap(ShaderType shaderType)
 {
 
-	glDeleteProgram(m_program);
-	m_program = 0;
+	switch (shaderType)
+	{
+		case VERTEX_SHADER   : return &m_vertexShaderIDMap;
+		case FRAGMENT_SHADER : return &m_fragmentShaderIDMap;
+		case GEOMETRY_SHADER : return &m_geometryShaderIDMap;
+	}
+
+	return &m_vertexShaderIDMap;
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -403,6 +1093,8 @@ void ShaderManager::Output()
 	std::cout << "Size of Vertex Shader ID Map   : " << m_vertexShaderIDMap.size() << std::endl;
 	std::cout << "Size of Fragment Shader ID Map : " << m_fragmentShaderIDMap.size() << std::endl;
 	std::cout << "Size of Geometry Shader ID Map : " << m_geometryShaderIDMap.size() << std::endl;
+	std::cout << "Amount of Shader Programs      : " << m_programs.size() << std::endl;
+	std::cout << "Amount of Shader Variants      : " << m_variants.size() << std::endl;
 	std::cout << "------------------------------------" << std::endl;
 
 }
\ No newline at end of file
@@ -10,29 +10,67 @@
 
   -----------------------------------------------------------------------------------------------
 
-- This is a Singleton Manager class that controls the main shader program and all of its shader 
+- This is a Singleton Manager class that controls all shader programs and all of their shader 
   objects. It can create and destroy multiple vertex, fragment and geometry shaders and manage
-  their components accordingly. Shaders can be attached and detatched at any time to allow for
-  multiple shaders to be used in the client code. The manager class has an ID for the main shader
-  program and three maps of IDs, each for the vertex, fragment and geometry shaders.
+  their components accordingly. The manager class stores all shader IDs in one slot map, with 
+  three maps of handles to them, each for the vertex, fragment and geometry shaders. Shaders that 
+  do not exist are reported instead of silently being added to the maps when compiling them or 
+  creating programs with them.
 
-- Two enum types have been created. The RemoveType enum is used when removing shader IDs from the
+- Three enum types have been created. The RemoveType enum is used when removing shader IDs from the
   map. Either one single specific shader ID can be removed, or the entire map of shaders can be 
   cleared. The ShaderType enum is there for letting the manager class know what type of shader it 
-  will de dealing with.
+  will de dealing with. The Feature enum flags can be combined and passed to Compile(), which 
+  adds a #define for each one of them to the shader code, so that one shader file can be used
+  for many different variants of a shader, such as with or without textures.
 
 - The four getters and setters allow access to the different shader variables. There are two 
   getter routines for aquiring the IDs of the uniform and attribute variables from inside the 
-  shaders. There are also two setter functions that allow data to be linked / sent to a the 
-  shader uniform and attribute variables. The two setter functions are temporary solutions!!
+  shaders. These IDs are not requested from OpenGL each time, which would mean a string lookup 
+  per draw call, but are all read in once when a program is linked and stored in the program's 
+  own tables. Names that the shaders do not use are returned as -1. There are also two setter 
+  functions that allow data to be linked / sent to the shader uniform and attribute variables. 
+  The two setter functions are temporary solutions!!
+  The second SetAttribute() routine is used for interleaved buffers, where all vertex data sits
+  in one buffer, and is passed the size of one whole vertex and where the attribute starts in it,
+  both in bytes. The SetPackedAttribute() routine links an RGBA color that is packed into four 
+  bytes, each of which the shader sees as a value between 0 and 1. Shader attributes are switched
+  on and off and the shader program is activated through the state cache, which skips doing so if
+  they already are.
   
-- The main functions in the class allow for the main shader program to be created and initialised
-  as well as allowing various shaders to be created, compiled, linked, attached, destroyed etc.
-  For each main function there is a correponding opposing routine, ie Initialize() and its 
-  counterpart ShutDown(). However, there is no Unlink() routine for the Link() function. To 
-  use different shaders with the current shader program, simply detach the shaders and attach the
-  new shaders before linking them. The shaders need to be attached before they are linked with
-  the main program. 
+- The main functions in the class allow for various shaders to be created, compiled and destroyed,
+  and for shader programs to be created from them. Linking a program is one of the slowest things
+  OpenGL can be asked to do, so each combination of shaders is linked only once, up front, using
+  the CreateProgram() routine, and is stored under the name passed. Calling it again with the same
+  name and shaders does nothing, so it is safe to call from objects that are created many times.
+  The UseProgram() function then simply switches to the named program, which is cheap, and the 
+  uniform and attribute getters always refer to the program currently in use. The uniforms that
+  are set for every object drawn have their own getters, which return the ID stored when the 
+  program was linked, so that no name has to be looked up for each draw call. The ShutDown() 
+  routine destroys all programs and all shaders that are still left. 
+
+- Compiling shaders is slow as well, which is why the Compile() routine only reads in the shader
+  source code and the shaders are compiled only when a program first needs them. Each linked 
+  program is saved to a binary file in the Shaders folder, named after a hash of all its shader
+  source code and the graphics card and driver version. On the next run, CreateProgram() loads
+  that file instead and no shaders are compiled at all. If the driver does not support program
+  binaries, or rejects the file after a driver update, the program is simply built from source.
+
+- Before it is stored, shader source code is preprocessed. Each #include "File" line is replaced 
+  with the contents of the file named, which is found relative to the file including it, and the
+  defines of all features passed are added right after the #version line. The result is stored
+  for each combination of file and features, so that any variant is only read in once. Shaders 
+  created under different names from the same variant also share one shader object, which is 
+  therefore only compiled once and is only destroyed once no name uses it anymore.
+
+- Data that is the same for all shaders, such as the projection matrix, is stored in one uniform
+  buffer that every program shares through the "FrameData" uniform block. The SetFrameData() 
+  routine is called by the Screen Manager whenever the projection changes, and only sends the
+  data to the graphics card if it is any different from before, so at most once per projection 
+  per frame. Only per-object data, such as the modelview matrix, is sent to each program per draw.
+
+- When the screen runs in headless mode there is no OpenGL context, so no shaders are created,
+  compiled or destroyed at all.
 
 - An Output() routine is there for debug purposes only and will print to the console how many 
   shader IDs are currently stored in the various shader ID maps.
@@ -46,6 +84,14 @@
 #include <string>
 #include <OpenGL.h>
 #include "Singleton.h"
+#include "SlotMap.h"
+
+//the uniform block binding point and amount of floats of the shared per-frame data
+const GLuint FRAME_DATA_BINDING = 0;
+const int FRAME_DATA_SIZE = 16;
+
+//the amount of times shader files may include other files within each other
+const int MAX_INCLUDE_DEPTH = 16;
 
 class ShaderManager
 {
@@ -54,6 +100,7 @@ public :
 
 	enum RemoveType { CUSTOM_SHADER, ALL_SHADERS };
 	enum ShaderType { VERTEX_SHADER, FRAGMENT_SHADER, GEOMETRY_SHADER };
+	enum Feature    { NO_FEATURES = 0, TEXTURED = 1, INSTANCED = 2, VERTEX_COLOR = 4 };
 
 public:
 
@@ -63,8 +110,16 @@ public:
 
 	GLint GetUniform(const std::string& name);
 	GLint GetAttribute(const std::string& name);
+	GLint GetModelviewUniform();
+	GLint GetTextureOffsetUniform();
+	const std::string& GetProgramName();
 	void SetUniform(GLint attributeID, GLfloat* data);
+	void SetUniform(GLint attributeID, GLfloat x, GLfloat y);
+	void SetFrameData(GLfloat* projectionMatrix);
 	void SetAttribute(GLint attributeID, GLint componentSize);
+	void SetAttribute(GLint attributeID, GLint componentSize, GLsizei stride, GLuint offset);
+	void SetPackedAttribute(GLint attributeID, GLsizei stride, GLuint offset);
+	void SetAttributeDivisor(GLint attributeID, GLuint divisor);
 
 public:
 
@@ -73,19 +128,17 @@ public:
 
 public:
 
-	bool Initialize();
 	bool Create(ShaderType shaderType, const std::string& mapIndex);
-	void Attach(ShaderType shaderType, const std::string& mapIndex);
+	bool Compile(ShaderType shaderType, const std::string& filename, 
+		         const std::string& mapIndex, int features = NO_FEATURES);
+	void Destroy(ShaderType shaderType, RemoveType removeType, const std::string& mapIndex = "");
 
 public :
 
-	bool Compile(ShaderType shaderType, const std::string& filename, const std::string& mapIndex);
-	bool Link();
-	
-public:
-
-	void Detach(ShaderType shaderType, const std::string& mapIndex);
-	void Destroy(ShaderType shaderType, RemoveType removeType, const std::string& mapIndex = "");
+	bool CreateProgram(const std::string& programName, const std::string& vertexShader,
+		               const std::string& fragmentShader, const std::string& geometryShader = "");
+	bool UseProgram(const std::string& programName);
+	void DestroyProgram(const std::string& programName);
 	void ShutDown();
 
 public :
@@ -100,11 +153,62 @@ private:
 
 private:
 
-	GLint m_program;
+	struct Program
+	{
+		GLuint ID;
+		std::string key;
+		std::map<std::string, GLint> uniforms;
+		std::map<std::string, GLint> attributes;
+		GLint modelviewUniformID;
+		GLint textureOffsetUniformID;
+	};
+
+	struct Source
+	{
+		std::string code;
+		std::string variant;
+		bool isCompiled;
+		int totalUsers;
+	};
+
+private:
+
+	bool Link(GLuint programID);
+	void Reflect(Program& program);
+	bool CompileShader(GLuint shaderID);
+	void Release(GLuint shaderID);
+
+private:
+
+	bool Preprocess(const std::string& filename, std::string& sourceCode, int depth);
+	void AddFeatures(std::string& sourceCode, int features);
+
+private:
+
+	std::string GetBinaryFilename(const GLuint* shaderIDs, int totalShaders);
+	bool LoadBinary(GLuint programID, const std::string& filename);
+	void SaveBinary(GLuint programID, const std::string& filename);
+	GLuint GetShaderID(ShaderType shaderType, const std::string& mapIndex);
+	std::map<std::string, Handle>* GetHandleMap(ShaderType shaderType);
+
+private:
+
+	GLuint m_program;
+	Program* m_activeProgram;
+	std::string m_programName;
+	std::map<std::string, Program> m_programs;
+	std::map<GLuint, Source> m_shaderSources;
+	std::map<std::string, std::string> m_variants;
+	std::map<std::string, GLuint> m_variantShaders;
+
+	GLuint m_frameBufferID;
+	GLfloat m_frameData[FRAME_DATA_SIZE];
+
+	SlotMap<GLuint> m_shaderIDs;
 
-	std::map<std::string, GLuint> m_vertexShaderIDMap;
-	std::map<std::string, GLuint> m_fragmentShaderIDMap;
-	std::map<std::string, GLuint> m_geometryShaderIDMap;
+	std::map<std::string, Handle> m_vertexShaderIDMap;
+	std::map<std::string, Handle> m_fragmentShaderIDMap;
+	std::map<std::string, Handle> m_geometryShaderIDMap;
 
 };
 
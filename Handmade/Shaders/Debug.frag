@@ -1,11 +0,0 @@
-#version 150
-
-in vec4 fragColor;
-out vec4 colorOut;
-
-void main(void)
-{
-
-	colorOut = fragColor;
-
-}
\ No newline at end of file
@@ -0,0 +1,6 @@
+//shared data that is the same for all shader programs and set once per projection
+
+layout(std140) uniform FrameData
+{
+	mat4 projectionMatrix;
+};
\ No newline at end of file
@@ -1,15 +1,20 @@
 #version 150
 
-uniform sampler2D textureImage;
-
 in vec4 fragColor;
-in vec2 textureOut;
-
 out vec4 colorOut;
 
+#ifdef TEXTURED
+uniform sampler2D textureImage;
+in vec2 textureOut;
+#endif
+
 void main(void)
 {
 
+#ifdef TEXTURED
 	colorOut = fragColor * texture(textureImage, textureOut.st);
+#else
+	colorOut = fragColor;
+#endif
 
 }
\ No newline at end of file
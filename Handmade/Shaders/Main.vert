@@ -1,20 +1,45 @@
 #version 150
 
-uniform mat4 projectionMatrix;
+#include "FrameData.glsl"
+
 uniform mat4 modelviewMatrix;
 
-in vec4 colorIn;
 in vec3 vertexIn;
-in vec2 textureIn;
-
 out vec4 fragColor;
+
+#ifdef VERTEX_COLOR
+in vec4 colorIn;
+#endif
+
+#ifdef TEXTURED
+uniform vec2 textureOffset;
+in vec2 textureIn;
 out vec2 textureOut;
+#endif
+
+#ifdef INSTANCED
+in mat4 instanceMatrixIn;
+in vec4 instanceColorIn;
+#endif
 
 void main(void)
 {
 
-	textureOut = textureIn;
+#ifdef VERTEX_COLOR
 	fragColor = colorIn;
+#else
+	fragColor = vec4(1.0);
+#endif
+
+#ifdef TEXTURED
+	textureOut = textureIn + textureOffset;
+#endif
+
+#ifdef INSTANCED
+	fragColor *= instanceColorIn;
+	gl_Position = projectionMatrix * modelviewMatrix * instanceMatrixIn * vec4(vertexIn, 1.0);
+#else
 	gl_Position = projectionMatrix * modelviewMatrix * vec4(vertexIn, 1.0);
+#endif
 	
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+#version 150
+
+in vec3 centerIn;
+in vec2 sizeIn;
+in float rotationIn;
+in vec4 textureRectIn;
+in vec4 colorIn;
+
+out vec2 size;
+out float rotation;
+out vec4 textureRect;
+out vec4 color;
+
+void main(void)
+{
+
+	//the geometry shader turns each point into a quad
+	size = sizeIn;
+	rotation = rotationIn;
+	textureRect = textureRectIn;
+	color = colorIn;
+	gl_Position = vec4(centerIn, 1.0);
+	
+}
\ No newline at end of file
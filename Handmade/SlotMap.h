@@ -0,0 +1,211 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This is a templatized class that stores resources in a vector of slots and hands out handles to
+  them, instead of having them looked up by name in a map each time they are used. A handle holds
+  the index of the resource's slot and the generation of that slot at the time the resource was 
+  added. Finding a resource by its handle is then a matter of indexing the vector and comparing 
+  the generation, without any string comparing or hashing at all. The managers use a slot map to
+  store their resources and only use names when loading them and when handing out their handles.
+
+- Each time a resource is removed, its slot's generation is increased and the slot is reused for 
+  the next resource that is added. Handles to the removed resource therefore no longer match the 
+  slot's generation, and the Get() function returns a null pointer for them, instead of silently
+  returning whatever resource moved into the slot since. Generation 0 is never used by any slot, 
+  so that a default handle is always a null handle.
+
+- Pointers returned by the Get() function become invalid as soon as resources are added, because 
+  the vector may grow, so they should not be kept. Handles on the other hand never become invalid 
+  until the resource they refer to is removed. 
+
+*/
+
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <vector>
+
+struct Handle
+{
+
+	Handle(unsigned int index = 0, unsigned int generation = 0) : 
+		   index(index), generation(generation) {}
+
+	bool IsNull() const { return generation == 0; }
+
+	unsigned int index;
+	unsigned int generation;
+
+};
+
+template <class T> class SlotMap
+{
+
+public:
+
+	SlotMap();
+
+public:
+
+	int GetSize() const;
+	bool IsValid(Handle handle) const;
+	T* Get(Handle handle);
+
+public:
+
+	Handle Add(const T& value);
+	bool Remove(Handle handle);
+	void Clear();
+
+public:
+
+	template <typename Func> void ForEach(Func func);
+
+private:
+
+	struct Slot
+	{
+		T value;
+		bool isAlive;
+		unsigned int generation;
+	};
+
+private:
+
+	int m_size;
+	std::vector<Slot> m_slots;
+	std::vector<unsigned int> m_freeSlots;
+
+};
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+template <class T> SlotMap<T>::SlotMap()
+{
+
+	m_size = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of resources stored
+//------------------------------------------------------------------------------------------------------
+template <class T> int SlotMap<T>::GetSize() const
+{
+
+	return m_size;
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if the handle passed still refers to a stored resource
+//------------------------------------------------------------------------------------------------------
+template <class T> bool SlotMap<T>::IsValid(Handle handle) const
+{
+
+	return (handle.index < m_slots.size() && m_slots[handle.index].isAlive &&
+		    m_slots[handle.index].generation == handle.generation);
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns resource of the handle passed or null if the handle is stale
+//------------------------------------------------------------------------------------------------------
+template <class T> T* SlotMap<T>::Get(Handle handle)
+{
+
+	return (IsValid(handle) ? &m_slots[handle.index].value : 0);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that stores the resource passed in a free slot and returns a handle to it
+//------------------------------------------------------------------------------------------------------
+template <class T> Handle SlotMap<T>::Add(const T& value)
+{
+
+	unsigned int index = 0;
+
+	//reuse a slot of a removed resource if there is one
+	//otherwise add a new slot to the back starting at generation 1
+	if (!m_freeSlots.empty())
+	{
+		index = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+
+	else
+	{
+		Slot slot = { value, false, 1 };
+		index = m_slots.size();
+		m_slots.push_back(slot);
+	}
+
+	m_slots[index].value = value;
+	m_slots[index].isAlive = true;
+	m_size++;
+
+	return Handle(index, m_slots[index].generation);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes the resource of the handle passed and makes all its handles stale
+//------------------------------------------------------------------------------------------------------
+template <class T> bool SlotMap<T>::Remove(Handle handle)
+{
+
+	if (!IsValid(handle))
+	{
+		return false;
+	}
+
+	Slot& slot = m_slots[handle.index];
+
+	//move slot on to the next generation, skipping 0 when it wraps around
+	slot.isAlive = false;
+	slot.generation = (slot.generation + 1 > 0 ? slot.generation + 1 : 1);
+	
+	m_freeSlots.push_back(handle.index);
+	m_size--;
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that removes all resources and makes all handles handed out stale
+//------------------------------------------------------------------------------------------------------
+template <class T> void SlotMap<T>::Clear()
+{
+
+	for (unsigned int i = 0; i < m_slots.size(); i++)
+	{
+		if (m_slots[i].isAlive)
+		{
+			Remove(Handle(i, m_slots[i].generation));
+		}
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that calls the function passed for each resource stored
+//------------------------------------------------------------------------------------------------------
+template <class T> template <typename Func> void SlotMap<T>::ForEach(Func func)
+{
+
+	for (auto it = m_slots.begin(); it != m_slots.end(); it++)
+	{
+		if (it->isAlive)
+		{
+			func(it->value);
+		}
+	}
+
+}
+
+#endif
\ No newline at end of file
@@ -113,4 +113,16 @@ void Sphere2D::Draw()
 	//the pixel scale value is already integrated when the dimension is set earlier
 	TheDebug::Instance()->DrawSphere2D(m_dimension, m_color, 40, 1);
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns world space box around bound
+//------------------------------------------------------------------------------------------------------
+bool Sphere2D::GetExtent(Vector3D<float>& min, Vector3D<float>& max) const
+{
+
+	min = Vector3D<float>(m_position.X - m_radius, m_position.Y - m_radius, m_position.Z);
+	max = Vector3D<float>(m_position.X + m_radius, m_position.Y + m_radius, m_position.Z);
+
+	return true;
+
 }
\ No newline at end of file
@@ -113,4 +113,16 @@ void Sphere3D::Draw()
 	//draw bound based on dimension and color set 
 	TheDebug::Instance()->DrawSphere3D(m_dimension, m_color);
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns world space box around bound
+//------------------------------------------------------------------------------------------------------
+bool Sphere3D::GetExtent(Vector3D<float>& min, Vector3D<float>& max) const
+{
+
+	min = Vector3D<float>(m_position.X - m_radius, m_position.Y - m_radius, m_position.Z - m_radius);
+	max = Vector3D<float>(m_position.X + m_radius, m_position.Y + m_radius, m_position.Z + m_radius);
+
+	return true;
+
 }
\ No newline at end of file
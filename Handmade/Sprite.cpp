@@ -1,5 +1,7 @@
 #include "BufferManager.h"
+#include "ShaderManager.h"
 #include "Sprite.h"
+#include "SpriteBatch.h"
 #include "TextureManager.h"
 
 //------------------------------------------------------------------------------------------------------
@@ -11,8 +13,8 @@ Sprite::Sprite()
 	//set flag to false by default
 	m_isSpriteCreated = false;
 
-	//assign ID to a default 0
-	m_textureID = 0;
+	//start off with a null handle that refers to no texture
+	m_texture = Handle();
 
 	//assign texture index to first sprite cell by default 
 	m_textureIndex = 0;
@@ -28,10 +30,17 @@ Sprite::Sprite()
 	m_textureDimension.X = 1;
 	m_textureDimension.Y = 1;
 
+	//texture coordinates are used as they are by default
+	m_textureOffset.X = 0.0f;
+	m_textureOffset.Y = 0.0f;
+
 	//set the component sizes for the sprite object's vertex and color data
 	m_buffer.SetComponentSize(Buffer::VERTEX_BUFFER, Buffer::XY);
 	m_buffer.SetComponentSize(Buffer::COLOR_BUFFER, Buffer::RGBA);
 
+	//store all vertex data in one interleaved VBO drawn using a VAO
+	m_buffer.IsInterleaved() = true;
+
 }
 //------------------------------------------------------------------------------------------------------
 //getter-setter function that returns color reference
@@ -72,12 +81,12 @@ void Sprite::SetTextureDimension(int column, int row)
 
 }
 //------------------------------------------------------------------------------------------------------
-//setter function that assigns texture image ID to sprite based on index value passed
+//setter function that assigns texture image handle to sprite based on index value passed
 //------------------------------------------------------------------------------------------------------
 void Sprite::SetTextureID(const std::string& mapIndex)
 {
 
-	m_textureID = TheTexture::Instance()->GetTextureID(mapIndex);
+	m_texture = TheTexture::Instance()->GetTexture(mapIndex);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -154,6 +163,9 @@ void Sprite::Draw()
 void Sprite::FillBuffers()
 {
 
+	//dynamic sprites change every frame and are written into the streaming ring buffer
+	m_buffer.IsStreamed() = (m_spriteType == DYNAMIC);
+
 	m_buffer.FillData(Buffer::COLOR_BUFFER);
 	m_buffer.FillData(Buffer::VERTEX_BUFFER);
 	m_buffer.FillData(Buffer::TEXTURE_BUFFER);
@@ -169,6 +181,29 @@ void Sprite::ClearBufferData()
 	m_buffer.Vertices().clear();
 	m_buffer.Textures().clear();
 
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if sprite data needs to be created again
+//------------------------------------------------------------------------------------------------------
+bool Sprite::IsDataChanged()
+{
+
+	return (!m_isSpriteCreated || m_color != m_createdColor ||
+		    m_spriteDimension != m_createdSpriteDimension || 
+		    m_textureDimension != m_createdTextureDimension);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that remembers what the sprite data was created with
+//------------------------------------------------------------------------------------------------------
+void Sprite::StoreCreatedData()
+{
+
+	m_isSpriteCreated = true;
+	m_createdColor = m_color;
+	m_createdSpriteDimension = m_spriteDimension;
+	m_createdTextureDimension = m_textureDimension;
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that binds the texture, and sends sprite data to shaders 
@@ -176,12 +211,36 @@ void Sprite::ClearBufferData()
 void Sprite::CreateSprite()
 {
 
+	//hand the sprite over to the sprite batch to be drawn 
+	//together with all other sprites using the same texture
+	if (TheSpriteBatch::Instance()->IsEnabled())
+	{
+		TheSpriteBatch::Instance()->Submit(TheTexture::Instance()->GetTextureID(m_texture), 
+			                               m_buffer, m_textureOffset);
+		return;
+	}
+
 	//bind texture with sprite based on texture ID
-	TheTexture::Instance()->Enable(m_textureID);
+	TheTexture::Instance()->Enable(TheTexture::Instance()->GetTextureID(m_texture));
+
+	//let the shader move the texture coordinates onto the texture cell shown
+	//and set the offset back afterwards so that other sprites are not affected
+	bool isOffset = (m_textureOffset.X != 0.0f || m_textureOffset.Y != 0.0f);
+	GLint textureOffsetID = TheShader::Instance()->GetTextureOffsetUniform();
+
+	if (isOffset)
+	{
+		TheShader::Instance()->SetUniform(textureOffsetID, m_textureOffset.X, m_textureOffset.Y);
+	}
 
 	//send sprite data to shaders
 	m_buffer.DrawData(Buffer::TRIANGLES);
 
+	if (isOffset)
+	{
+		TheShader::Instance()->SetUniform(textureOffsetID, 0.0f, 0.0f);
+	}
+
 	//unbind texture so that there are no left over links
 	TheTexture::Instance()->Disable();
 
@@ -42,9 +42,13 @@
   function is there to be able to link the shader attribute variables with the sprite data via the
   internal Buffer object. The SetBufferID() function is able to link the sprite's internal buffer
   with the correct vertex, color and texture VBO. The SetTextureID() routine is used to assign an 
-  OpenGL texture ID to the sprite object. This ID is requested from the Texture Manager. The
+  OpenGL texture to the sprite object. A handle to the texture is requested from the Texture 
+  Manager, and its ID is looked up through the handle each time the sprite is drawn. The
   SetBufferID() and SetShaderAttribute() routines do not consider the normal buffer or normal
   shader attribute respectively, because 2D sprites need not worry over lighting (Temporary!!)
+  The internal buffer is interleaved, which means it stores all data in its own VBO, so the VBOs
+  linked with SetBufferID() are not actually used. Dynamic sprites, whose data is refilled every 
+  frame, stream their data through the shared streaming ring buffer instead of their own VBO.
 
 - The Draw() function is different in all the classes, therefore it will be virtually overriden 
   based on what object type is being used. The base class and the sub-classes all calculate the 
@@ -54,7 +58,15 @@
   class but are accessible in the sub-classes. They all perform the same functionality for all 
   classes, therefore they only need to be inside the base class. The CreateSprite() routine might
   seem overkill and could easily be integrated inside the Draw() function, but then the deriving
-  subclasses would have to duplicate code.
+  subclasses would have to duplicate code. When sprite batching is enabled, the CreateSprite()
+  routine does not draw the sprite itself but submits it to the sprite batch instead, so that
+  sprites, animations and text sharing a texture are all drawn together in one draw call.
+
+- The texture offset is added to all texture coordinates when the sprite is drawn, either by the 
+  sprite batch or by the shader. This lets a sprite show a different texture cell without having 
+  to create its data again, which is what the Animation class uses it for. The IsDataChanged() 
+  routine checks if the sprite's color or dimensions have changed since its data was last created,
+  which is remembered by calling StoreCreatedData(), so that subclasses only create it when needed.
 
 */
 
@@ -104,6 +116,11 @@ protected :
 	void FillBuffers();
 	void ClearBufferData();
 
+protected :
+
+	bool IsDataChanged();
+	void StoreCreatedData();
+
 protected :
 
 	void CreateSprite();
@@ -115,7 +132,7 @@ protected :
 
 	bool m_isSpriteCreated;
 
-	GLuint m_textureID;
+	Handle m_texture;
 	GLint m_textureIndex;
 
 	Color m_color;
@@ -124,7 +141,12 @@ protected :
 
 	Vector2D<GLint> m_textureCell;
 	Vector2D<GLint> m_textureDimension;
+	Vector2D<GLfloat> m_textureOffset;
 	Vector2D<GLfloat> m_spriteDimension;
+
+	Color m_createdColor;
+	Vector2D<GLint> m_createdTextureDimension;
+	Vector2D<GLfloat> m_createdSpriteDimension;
 	
 };
 
@@ -0,0 +1,518 @@
+#include <cmath>
+#include <cstring>
+#include "BufferManager.h"
+#include "ScreenManager.h"
+#include "ShaderManager.h"
+#include "SpriteBatch.h"
+#include "StreamBuffer.h"
+#include "TextureManager.h"
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+SpriteBatch::SpriteBatch()
+{
+
+	m_isEnabled = true;
+	m_isPointSprites = false;
+	m_isPendingPoints = false;
+
+	m_totalBatches = 0;
+	m_totalSprites = 0;
+	m_totalPendingSprites = 0;
+	m_frameBatches = 0;
+	m_frameSprites = 0;
+
+	m_textureID = 0;
+	m_vertexAttributeID = -1;
+	m_colorAttributeID = -1;
+	m_textureAttributeID = -1;
+
+	//batched vertices are already transformed and therefore 
+	//hold a Z value, and change every frame so are streamed
+	m_buffer.SetComponentSize(Buffer::VERTEX_BUFFER, Buffer::XYZ);
+	m_buffer.SetComponentSize(Buffer::COLOR_BUFFER, Buffer::RGBA);
+	m_buffer.SetComponentSize(Buffer::TEXTURE_BUFFER, Buffer::UV);
+
+	m_buffer.IsInterleaved() = true;
+	m_buffer.IsStreamed() = true;
+
+	m_bufferID = 0;
+	m_vertexArrayID = 0;
+	m_streamVertexArrayID = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that returns flag reference
+//------------------------------------------------------------------------------------------------------
+bool& SpriteBatch::IsEnabled()
+{
+
+	return m_isEnabled;
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that returns flag reference
+//------------------------------------------------------------------------------------------------------
+bool& SpriteBatch::IsPointSprites()
+{
+
+	return m_isPointSprites;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of batches drawn in previous frame
+//------------------------------------------------------------------------------------------------------
+int SpriteBatch::GetTotalBatches()
+{
+
+	return m_totalBatches;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of sprites drawn in previous frame
+//------------------------------------------------------------------------------------------------------
+int SpriteBatch::GetTotalSprites()
+{
+
+	return m_totalSprites;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates the point sprite shaders and the VAOs to draw point sprites with
+//------------------------------------------------------------------------------------------------------
+bool SpriteBatch::Initialize()
+{
+
+	//create point sprite shaders and return false if there are errors
+	if (!(TheShader::Instance()->Create(ShaderManager::VERTEX_SHADER, "POINT_SPRITE_VERTEX_SHADER")))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->Create(ShaderManager::GEOMETRY_SHADER, "POINT_SPRITE_GEOMETRY_SHADER")))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->Create(ShaderManager::FRAGMENT_SHADER, "POINT_SPRITE_FRAGMENT_SHADER")))
+	{
+		return false;
+	}
+
+	//compile point sprite shaders, the fragment shader is the same as the main one
+	if (!(TheShader::Instance()->Compile(ShaderManager::VERTEX_SHADER, 
+		                                 "Shaders\\PointSprite.vert", "POINT_SPRITE_VERTEX_SHADER")))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->Compile(ShaderManager::GEOMETRY_SHADER, 
+		                                 "Shaders\\PointSprite.geom", "POINT_SPRITE_GEOMETRY_SHADER")))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->Compile(ShaderManager::FRAGMENT_SHADER,
+		                                 "Shaders\\Main.frag", "POINT_SPRITE_FRAGMENT_SHADER",
+		                                 ShaderManager::TEXTURED | ShaderManager::VERTEX_COLOR)))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->CreateProgram("POINT_SPRITE_PROGRAM", "POINT_SPRITE_VERTEX_SHADER", 
+		                                       "POINT_SPRITE_FRAGMENT_SHADER", 
+		                                       "POINT_SPRITE_GEOMETRY_SHADER")))
+	{
+		return false;
+	}
+
+	//the shader attributes are linked with the program in use
+	TheShader::Instance()->UseProgram("POINT_SPRITE_PROGRAM");
+
+	//one VAO reads the points from the streaming ring buffer and 
+	//the other one from the batch's own VBO, for when the ring is full
+	m_streamVertexArrayID = TheBuffer::Instance()->CreateVertexArray();
+	SetupVertexArray(m_streamVertexArrayID, TheStreamBuffer::Instance()->GetBufferID());
+
+	m_bufferID = TheBuffer::Instance()->CreateBuffer();
+	m_vertexArrayID = TheBuffer::Instance()->CreateVertexArray();
+	SetupVertexArray(m_vertexArrayID, m_bufferID);
+
+	m_isPointSprites = true;
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that transforms sprite's vertices and adds them to the batch
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::Submit(GLuint textureID, Buffer& buffer, const Vector2D<GLfloat>& textureOffset)
+{
+
+	//use the current modelview matrix to move each sprite into place
+	//the matrix array is stored in column order
+	const GLfloat* matrix = TheScreen::Instance()->ModelViewMatrix().GetMatrixArray();
+	bool isPoints = IsPointSprite(buffer, matrix);
+
+	GLint vertexAttributeID = buffer.GetAttributeID(Buffer::VERTEX_BUFFER);
+	GLint colorAttributeID = buffer.GetAttributeID(Buffer::COLOR_BUFFER);
+	GLint textureAttributeID = buffer.GetAttributeID(Buffer::TEXTURE_BUFFER);
+
+	//if the sprite uses a different texture or shader the 
+	//batch so far is drawn first and a new batch is started
+	//the same happens when switching between points and whole vertices
+	if (m_totalPendingSprites > 0 && 
+		(isPoints != m_isPendingPoints || textureID != m_textureID || 
+		 vertexAttributeID != m_vertexAttributeID || colorAttributeID != m_colorAttributeID || 
+		 textureAttributeID != m_textureAttributeID))
+	{
+		Flush();
+	}
+
+	m_isPendingPoints = isPoints;
+	m_textureID = textureID;
+	m_vertexAttributeID = vertexAttributeID;
+	m_colorAttributeID = colorAttributeID;
+	m_textureAttributeID = textureAttributeID;
+
+	if (isPoints)
+	{
+		AddPoints(buffer, matrix, textureOffset);
+		m_totalPendingSprites++;
+		return;
+	}
+
+	//move each XY vertex into place
+	const std::vector<GLfloat>& vertices = buffer.Vertices();
+
+	for (size_t i = 0; i + 1 < vertices.size(); i += 2)
+	{
+		m_buffer.Vertices().push_back(matrix[0] * vertices[i] + matrix[4] * vertices[i + 1] + matrix[12]);
+		m_buffer.Vertices().push_back(matrix[1] * vertices[i] + matrix[5] * vertices[i + 1] + matrix[13]);
+		m_buffer.Vertices().push_back(matrix[2] * vertices[i] + matrix[6] * vertices[i + 1] + matrix[14]);
+	}
+
+	m_buffer.Colors().insert(m_buffer.Colors().end(), 
+		                     buffer.Colors().begin(), buffer.Colors().end());
+
+	//move each texture coordinate onto the texture cell shown
+	const std::vector<GLfloat>& textures = buffer.Textures();
+
+	for (size_t i = 0; i + 1 < textures.size(); i += 2)
+	{
+		m_buffer.Textures().push_back(textures[i] + textureOffset.X);
+		m_buffer.Textures().push_back(textures[i + 1] + textureOffset.Y);
+	}
+
+	m_totalPendingSprites++;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that draws all sprites in the batch in one draw call
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::Flush()
+{
+
+	if (m_totalPendingSprites == 0)
+	{
+		return;
+	}
+
+	//reset the amount of sprites waiting first, because drawing 
+	//the batch's own buffer below will want to flush the batch too
+	m_frameSprites += m_totalPendingSprites;
+	m_totalPendingSprites = 0;
+	m_frameBatches++;
+
+	if (m_isPendingPoints)
+	{
+		DrawPoints();
+		return;
+	}
+
+	//use the same shader attributes as the sprites in the batch
+	//the buffer will only link them again if they have changed
+	if (m_buffer.GetAttributeID(Buffer::VERTEX_BUFFER) != m_vertexAttributeID ||
+		m_buffer.GetAttributeID(Buffer::COLOR_BUFFER) != m_colorAttributeID ||
+		m_buffer.GetAttributeID(Buffer::TEXTURE_BUFFER) != m_textureAttributeID)
+	{
+		m_buffer.SetAttributeID(Buffer::VERTEX_BUFFER, m_vertexAttributeID);
+		m_buffer.SetAttributeID(Buffer::COLOR_BUFFER, m_colorAttributeID);
+		m_buffer.SetAttributeID(Buffer::TEXTURE_BUFFER, m_textureAttributeID);
+	}
+
+	//vertices are already transformed so draw them without any modelview transformation
+	Matrix4D identity;
+	GLint modelviewUniformID = TheShader::Instance()->GetModelviewUniform();
+	TheShader::Instance()->SetUniform(modelviewUniformID, identity.GetMatrixArray());
+
+	m_buffer.FillData(Buffer::VERTEX_BUFFER);
+	m_buffer.FillData(Buffer::COLOR_BUFFER);
+	m_buffer.FillData(Buffer::TEXTURE_BUFFER);
+
+	TheTexture::Instance()->Enable(m_textureID);
+	m_buffer.DrawData(Buffer::TRIANGLES);
+	TheTexture::Instance()->Disable();
+
+	//set the modelview matrix back to that of the Screen Manager
+	TheShader::Instance()->SetUniform(modelviewUniformID, 
+		                              TheScreen::Instance()->ModelViewMatrix().GetMatrixArray());
+
+	m_buffer.Vertices().clear();
+	m_buffer.Colors().clear();
+	m_buffer.Textures().clear();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that draws what is left in the batch and keeps track of the frame's draw amounts
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::EndFrame()
+{
+
+	Flush();
+
+	m_totalBatches = m_frameBatches;
+	m_totalSprites = m_frameSprites;
+
+	m_frameBatches = 0;
+	m_frameSprites = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that destroys the point sprite shaders and VAOs
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::ShutDown()
+{
+
+	TheBuffer::Instance()->DestroyVertexArray(m_streamVertexArrayID);
+	TheBuffer::Instance()->DestroyVertexArray(m_vertexArrayID);
+	TheBuffer::Instance()->DestroyBuffer(m_bufferID);
+
+	m_bufferID = 0;
+	m_vertexArrayID = 0;
+	m_streamVertexArrayID = 0;
+	m_isPointSprites = false;
+
+	TheShader::Instance()->DestroyProgram("POINT_SPRITE_PROGRAM");
+
+	TheShader::Instance()->Destroy(ShaderManager::VERTEX_SHADER, 
+		                           ShaderManager::CUSTOM_SHADER, "POINT_SPRITE_VERTEX_SHADER");
+	TheShader::Instance()->Destroy(ShaderManager::GEOMETRY_SHADER, 
+		                           ShaderManager::CUSTOM_SHADER, "POINT_SPRITE_GEOMETRY_SHADER");
+	TheShader::Instance()->Destroy(ShaderManager::FRAGMENT_SHADER, 
+		                           ShaderManager::CUSTOM_SHADER, "POINT_SPRITE_FRAGMENT_SHADER");
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if the sprite passed can be sent as points
+//------------------------------------------------------------------------------------------------------
+bool SpriteBatch::IsPointSprite(Buffer& buffer, const GLfloat* matrix)
+{
+
+	if (!m_isPointSprites)
+	{
+		return false;
+	}
+
+	//the sprite has to be made of whole quads of six XY vertices each,
+	//with a RGBA color and UV texture coordinate for each vertex
+	size_t totalVertexData = buffer.Vertices().size();
+
+	if (totalVertexData == 0 || totalVertexData % 12 != 0 || 
+		buffer.Colors().size() != totalVertexData * 2 || buffer.Textures().size() != totalVertexData)
+	{
+		return false;
+	}
+
+	//a point only holds one color, so quads with a color gradient are drawn as whole vertices
+	const std::vector<GLfloat>& colors = buffer.Colors();
+
+	for (size_t quad = 0; quad < colors.size(); quad += 24)
+	{
+		for (size_t i = quad + 4; i < quad + 24; i++)
+		{
+			if (colors[i] != colors[quad + i % 4])
+			{
+				return false;
+			}
+		}
+	}
+
+	//the quads have to stay flat in the XY plane once transformed, 
+	//because the geometry shader only rotates them around the Z axis
+	return (matrix[2] == 0.0f && matrix[6] == 0.0f && matrix[8] == 0.0f && matrix[9] == 0.0f);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that turns each quad of the sprite into one point and adds it to the batch
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::AddPoints(Buffer& buffer, const GLfloat* matrix, 
+	                        const Vector2D<GLfloat>& textureOffset)
+{
+
+	const std::vector<GLfloat>& vertices = buffer.Vertices();
+	const std::vector<GLfloat>& colors = buffer.Colors();
+	const std::vector<GLfloat>& textures = buffer.Textures();
+
+	//the size and rotation of the quads come from the length and angle of the 
+	//matrix's X and Y axes, a mirrored matrix flips the quad upside down
+	GLfloat scaleX = sqrt(matrix[0] * matrix[0] + matrix[1] * matrix[1]);
+	GLfloat scaleY = sqrt(matrix[4] * matrix[4] + matrix[5] * matrix[5]);
+	GLfloat rotation = atan2(matrix[1], matrix[0]);
+
+	if (matrix[0] * matrix[5] - matrix[1] * matrix[4] < 0.0f)
+	{
+		scaleY = -scaleY;
+	}
+
+	for (size_t quad = 0; quad < vertices.size(); quad += 12)
+	{
+
+		//find the corners of the quad
+		GLfloat minX = vertices[quad];
+		GLfloat maxX = vertices[quad];
+		GLfloat minY = vertices[quad + 1];
+		GLfloat maxY = vertices[quad + 1];
+
+		for (size_t i = quad + 2; i < quad + 12; i += 2)
+		{
+			minX = (vertices[i] < minX ? vertices[i] : minX);
+			maxX = (vertices[i] > maxX ? vertices[i] : maxX);
+			minY = (vertices[i + 1] < minY ? vertices[i + 1] : minY);
+			maxY = (vertices[i + 1] > maxY ? vertices[i + 1] : maxY);
+		}
+
+		//find the texture coordinates at the bottom left and top right corners
+		GLfloat textureRect[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		for (size_t i = quad; i < quad + 12; i += 2)
+		{
+
+			if (vertices[i] == minX && vertices[i + 1] == minY)
+			{
+				textureRect[0] = textures[i] + textureOffset.X;
+				textureRect[1] = textures[i + 1] + textureOffset.Y;
+			}
+
+			else if (vertices[i] == maxX && vertices[i + 1] == maxY)
+			{
+				textureRect[2] = textures[i] + textureOffset.X;
+				textureRect[3] = textures[i + 1] + textureOffset.Y;
+			}
+
+		}
+
+		//move the centre of the quad into place
+		GLfloat centreX = (minX + maxX) / 2.0f;
+		GLfloat centreY = (minY + maxY) / 2.0f;
+
+		PointSprite point;
+
+		point.centre[0] = matrix[0] * centreX + matrix[4] * centreY + matrix[12];
+		point.centre[1] = matrix[1] * centreX + matrix[5] * centreY + matrix[13];
+		point.centre[2] = matrix[2] * centreX + matrix[6] * centreY + matrix[14];
+
+		point.size[0] = (maxX - minX) / 2.0f * scaleX;
+		point.size[1] = (maxY - minY) / 2.0f * scaleY;
+		point.rotation = rotation;
+
+		memcpy(point.textureRect, textureRect, sizeof(textureRect));
+
+		//pack the color of the quad into four bytes, which the shader reads as normalised bytes
+		const GLfloat* color = &colors[quad * 2];
+
+		for (int i = 0; i < 4; i++)
+		{
+			GLfloat channel = (color[i] < 0.0f ? 0.0f : (color[i] > 1.0f ? 1.0f : color[i]));
+			point.color[i] = (GLubyte)(channel * 255.0f + 0.5f);
+		}
+
+		m_points.push_back(point);
+
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that draws all point sprites in the batch in one draw call
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::DrawPoints()
+{
+
+	GLsizeiptr stride = sizeof(PointSprite);
+	GLsizeiptr size = stride * m_points.size();
+	GLsizei totalPoints = m_points.size();
+	GLint firstPoint = 0;
+	GLuint vertexArrayID = m_streamVertexArrayID;
+
+	//draw points with the point sprite program and switch back to the program used before
+	std::string programName = TheShader::Instance()->GetProgramName();
+	TheShader::Instance()->UseProgram("POINT_SPRITE_PROGRAM");
+
+	//write points into the ring, or into the batch's own VBO if the ring is full
+	GLint offset = TheStreamBuffer::Instance()->Write(&m_points[0], size, stride);
+
+	if (offset != -1)
+	{
+		TheStreamBuffer::Instance()->Upload();
+		firstPoint = offset / stride;
+	}
+
+	else
+	{
+		TheBuffer::Instance()->Fill(m_bufferID, &m_points[0], size);
+		vertexArrayID = m_vertexArrayID;
+	}
+
+	TheTexture::Instance()->Enable(m_textureID);
+	TheBuffer::Instance()->EnableVertexArray(vertexArrayID);
+
+	glDrawArrays(GL_POINTS, firstPoint, totalPoints);
+
+	TheBuffer::Instance()->DisableVertexArray();
+	TheTexture::Instance()->Disable();
+
+	if (!programName.empty())
+	{
+		TheShader::Instance()->UseProgram(programName);
+	}
+
+	m_points.clear();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that links the point sprite shader attributes with the VBO passed inside the VAO passed
+//------------------------------------------------------------------------------------------------------
+void SpriteBatch::SetupVertexArray(GLuint vertexArrayID, GLuint bufferID)
+{
+
+	GLsizei stride = sizeof(PointSprite);
+
+	GLint centerAttributeID = TheShader::Instance()->GetAttribute("centerIn");
+	GLint sizeAttributeID = TheShader::Instance()->GetAttribute("sizeIn");
+	GLint rotationAttributeID = TheShader::Instance()->GetAttribute("rotationIn");
+	GLint textureRectAttributeID = TheShader::Instance()->GetAttribute("textureRectIn");
+	GLint colorAttributeID = TheShader::Instance()->GetAttribute("colorIn");
+
+	//all attribute links made while the VAO is bound are stored in the VAO
+	TheBuffer::Instance()->EnableVertexArray(vertexArrayID);
+	TheBuffer::Instance()->Enable(bufferID);
+
+	TheShader::Instance()->EnableAttribute(centerAttributeID);
+	TheShader::Instance()->SetAttribute(centerAttributeID, 3, stride, 0);
+
+	TheShader::Instance()->EnableAttribute(sizeAttributeID);
+	TheShader::Instance()->SetAttribute(sizeAttributeID, 2, stride, 3 * sizeof(GLfloat));
+
+	TheShader::Instance()->EnableAttribute(rotationAttributeID);
+	TheShader::Instance()->SetAttribute(rotationAttributeID, 1, stride, 5 * sizeof(GLfloat));
+
+	TheShader::Instance()->EnableAttribute(textureRectAttributeID);
+	TheShader::Instance()->SetAttribute(textureRectAttributeID, 4, stride, 6 * sizeof(GLfloat));
+
+	TheShader::Instance()->EnableAttribute(colorAttributeID);
+	TheShader::Instance()->SetPackedAttribute(colorAttributeID, stride, 10 * sizeof(GLfloat));
+
+	TheBuffer::Instance()->DisableVertexArray();
+
+}
\ No newline at end of file
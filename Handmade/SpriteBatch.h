@@ -0,0 +1,141 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates a sprite batch which collects the quads of all sprites drawn one after
+  the other and draws them together in one single draw call, instead of one draw call per sprite. 
+  This matters most for text, where every character is its own quad, and for scenes with many 
+  small sprites. This class is a Singleton.
+
+- Sprites, animations and text submit their buffer via the Submit() routine instead of drawing it
+  themselves. The sprite's vertices are moved into place on the CPU using the current modelview 
+  matrix of the Screen Manager, so that quads with different transformations can share one draw. 
+  The submitted buffer is expected to hold XY vertices, RGBA colors and UV texture coordinates, 
+  which is how the Sprite class lays out its data. The texture offset passed is added to all of 
+  the sprite's texture coordinates, which is how animations show their current texture cell.
+
+- All quads in a batch have to share the same texture and shader attributes. When a sprite is 
+  submitted with a different texture or shader, the batch is drawn first and a new one started.
+  Anything else that changes the way sprites appear on screen also draws the batch first. This 
+  happens when any other buffer is drawn, when a shader program is linked and when the screen 
+  switches between 2D and 3D mode, which changes the projection and blend state. This way sprites 
+  still appear in exactly the order they were drawn in. 
+
+- Because the vertices are already transformed, the batch is drawn with an identity modelview 
+  matrix, after which the shader's modelview matrix is set back to that of the Screen Manager. 
+  Client code therefore needs to keep the shader's matrices the same as the Screen Manager's ones,
+  which is how all client code sets them anyway.
+
+- Sending six whole vertices with a color each for every sprite is a lot of data, especially for
+  scenes with many particles. Once the Initialize() routine has created the point sprite shaders,
+  each sprite quad is therefore sent as one single point instead, holding only its centre, size, 
+  rotation, texture coordinates and one color packed into four bytes. A geometry shader turns each
+  point back into a quad on the graphics card. This only works for quads that lie flat in the XY 
+  plane after being transformed and have the same color on all six vertices, which all 2D sprites
+  and text do. Any other sprites are batched 
+  as whole vertices like before, and switching between the two draws the batch first. The point 
+  sprite path can be switched off using the IsPointSprites() function. The ShutDown() routine 
+  destroys the shaders and buffers again, and both routines are called by the Game class.
+
+- The batched data is written into the streaming ring buffer. The EndFrame() routine needs to be
+  called after drawing each frame, which is done by the Game class. It draws what is left in the
+  batch and keeps track of how many batches and sprites were drawn, which can be requested with 
+  the GetTotalBatches() and GetTotalSprites() functions. Batching can be switched off using the 
+  IsEnabled() function, in which case sprites simply draw themselves as before.
+
+*/
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <OpenGL.h>
+#include "Buffer.h"
+#include "Singleton.h"
+#include "Vector2D.h"
+
+//one point sprite as it is sent to the graphics card, which is its centre, size, rotation, 
+//texture coordinates at two opposite corners and one RGBA color packed into four bytes
+struct PointSprite
+{
+	GLfloat centre[3];
+	GLfloat size[2];
+	GLfloat rotation;
+	GLfloat textureRect[4];
+	GLubyte color[4];
+};
+
+class SpriteBatch
+{
+
+public:
+
+	friend class Singleton<SpriteBatch>;
+
+public:
+
+	bool& IsEnabled();
+	bool& IsPointSprites();
+
+public:
+
+	int GetTotalBatches();
+	int GetTotalSprites();
+
+public:
+
+	bool Initialize();
+	void Submit(GLuint textureID, Buffer& buffer, const Vector2D<GLfloat>& textureOffset);
+	void Flush();
+	void EndFrame();
+	void ShutDown();
+
+private:
+
+	SpriteBatch();
+	SpriteBatch(const SpriteBatch&);
+	SpriteBatch& operator=(const SpriteBatch&);
+
+private:
+
+	bool IsPointSprite(Buffer& buffer, const GLfloat* matrix);
+	void AddPoints(Buffer& buffer, const GLfloat* matrix, const Vector2D<GLfloat>& textureOffset);
+	void DrawPoints();
+	void SetupVertexArray(GLuint vertexArrayID, GLuint bufferID);
+
+private:
+
+	bool m_isEnabled;
+	bool m_isPointSprites;
+	bool m_isPendingPoints;
+
+	int m_totalBatches;
+	int m_totalSprites;
+	int m_totalPendingSprites;
+	int m_frameBatches;
+	int m_frameSprites;
+
+	GLuint m_textureID;
+	GLint m_vertexAttributeID;
+	GLint m_colorAttributeID;
+	GLint m_textureAttributeID;
+
+	Buffer m_buffer;
+
+	GLuint m_bufferID;
+	GLuint m_vertexArrayID;
+	GLuint m_streamVertexArrayID;
+	std::vector<PointSprite> m_points;
+
+};
+
+typedef Singleton<SpriteBatch> TheSpriteBatch;
+
+#endif
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include "Game.h"
 #include "ShaderManager.h"
 #include "StartState.h"
 
@@ -21,14 +22,43 @@ bool StartState::OnEnter()
 
 	//compile vertex shader for main program and return false if there are errors
 	if (!(TheShader::Instance()->Compile(ShaderManager::VERTEX_SHADER,
-		                                 "Shaders\\Main.vert", "MAIN_VERTEX_SHADER")))
+		                                 "Shaders\\Main.vert", "MAIN_VERTEX_SHADER",
+		                                 ShaderManager::TEXTURED | ShaderManager::VERTEX_COLOR)))
 	{
 		return false;
 	}
 
 	//compile fragment shader for main program and return false if there are errors
 	if (!(TheShader::Instance()->Compile(ShaderManager::FRAGMENT_SHADER,
-		                                 "Shaders\\Main.frag", "MAIN_FRAGMENT_SHADER")))
+		                                 "Shaders\\Main.frag", "MAIN_FRAGMENT_SHADER",
+		                                 ShaderManager::TEXTURED | ShaderManager::VERTEX_COLOR)))
+	{
+		return false;
+	}
+
+	//create and compile the instanced variant of the main vertex shader for drawing instanced models
+	if (!(TheShader::Instance()->Create(ShaderManager::VERTEX_SHADER, "INSTANCED_VERTEX_SHADER")))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->Compile(ShaderManager::VERTEX_SHADER,
+		                                 "Shaders\\Main.vert", "INSTANCED_VERTEX_SHADER", 
+		                                 ShaderManager::TEXTURED | ShaderManager::VERTEX_COLOR |
+		                                 ShaderManager::INSTANCED)))
+	{
+		return false;
+	}
+
+	//link the main and instanced shader programs once, up front
+	if (!(TheShader::Instance()->
+		  CreateProgram("MAIN_PROGRAM", "MAIN_VERTEX_SHADER", "MAIN_FRAGMENT_SHADER")))
+	{
+		return false;
+	}
+
+	if (!(TheShader::Instance()->
+		  CreateProgram("INSTANCED_PROGRAM", "INSTANCED_VERTEX_SHADER", "MAIN_FRAGMENT_SHADER")))
 	{
 		return false;
 	}
@@ -41,6 +71,9 @@ bool StartState::OnEnter()
 	//it only activates after the first one is done
 	m_APILogo->IsActive() = false;
 
+	//start loading the main state while the splash screens run
+	TheGame::Instance()->PreloadNext();
+
 	return true;
 
 }
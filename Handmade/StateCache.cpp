@@ -0,0 +1,231 @@
+#include "StateCache.h"
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+StateCache::StateCache()
+{
+
+	m_totalIssued = 0;
+	m_totalSkipped = 0;
+	m_lastTotalIssued = 0;
+	m_lastTotalSkipped = 0;
+
+	m_bufferID = 0;
+	m_vertexArrayID = 0;
+	m_textureID = 0;
+	m_programID = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of OpenGL calls sent during the previous frame
+//------------------------------------------------------------------------------------------------------
+int StateCache::GetTotalIssued()
+{
+
+	return m_lastTotalIssued;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns amount of OpenGL calls skipped during the previous frame
+//------------------------------------------------------------------------------------------------------
+int StateCache::GetTotalSkipped()
+{
+
+	return m_lastTotalSkipped;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds the VBO passed unless it is already bound
+//------------------------------------------------------------------------------------------------------
+void StateCache::BindBuffer(GLuint bufferID)
+{
+
+	if (IsChanged(bufferID != m_bufferID))
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, bufferID);
+		m_bufferID = bufferID;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds the VAO passed unless it is already bound
+//------------------------------------------------------------------------------------------------------
+void StateCache::BindVertexArray(GLuint vertexArrayID)
+{
+
+	if (IsChanged(vertexArrayID != m_vertexArrayID))
+	{
+		glBindVertexArray(vertexArrayID);
+		m_vertexArrayID = vertexArrayID;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that binds the texture passed to the first texture unit unless it is already bound
+//------------------------------------------------------------------------------------------------------
+void StateCache::BindTexture(GLuint textureID)
+{
+
+	if (IsChanged(textureID != m_textureID))
+	{
+		glBindTexture(GL_TEXTURE_2D, textureID);
+		m_textureID = textureID;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that activates the shader program passed unless it is already active
+//------------------------------------------------------------------------------------------------------
+void StateCache::UseProgram(GLuint programID)
+{
+
+	if (IsChanged(programID != m_programID))
+	{
+		glUseProgram(programID);
+		m_programID = programID;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that switches on the shader attribute passed in the bound VAO unless it already is
+//------------------------------------------------------------------------------------------------------
+void StateCache::EnableAttribute(GLint attributeID)
+{
+
+	//attributes the active shader does not use have no ID and are skipped
+	if (attributeID < 0)
+	{
+		return;
+	}
+
+	//attributes that cannot be kept track of are always sent
+	if (attributeID > 31)
+	{
+		IsChanged(true);
+		glEnableVertexAttribArray(attributeID);
+		return;
+	}
+
+	unsigned int& mask = m_attributeMasks[m_vertexArrayID];
+	unsigned int bit = 1 << attributeID;
+
+	if (IsChanged(!(mask & bit)))
+	{
+		glEnableVertexAttribArray(attributeID);
+		mask |= bit;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that switches off the shader attribute passed in the bound VAO unless it already is
+//------------------------------------------------------------------------------------------------------
+void StateCache::DisableAttribute(GLint attributeID)
+{
+
+	//attributes the active shader does not use have no ID and are skipped
+	if (attributeID < 0)
+	{
+		return;
+	}
+
+	//attributes that cannot be kept track of are always sent
+	if (attributeID > 31)
+	{
+		IsChanged(true);
+		glDisableVertexAttribArray(attributeID);
+		return;
+	}
+
+	unsigned int& mask = m_attributeMasks[m_vertexArrayID];
+	unsigned int bit = 1 << attributeID;
+
+	if (IsChanged((mask & bit) != 0))
+	{
+		glDisableVertexAttribArray(attributeID);
+		mask &= ~bit;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that resets the VBO binding if the deleted VBO passed was bound
+//------------------------------------------------------------------------------------------------------
+void StateCache::ForgetBuffer(GLuint bufferID)
+{
+
+	if (m_bufferID == bufferID)
+	{
+		m_bufferID = 0;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that resets the VAO binding if the deleted VAO passed was bound and drops its attributes
+//------------------------------------------------------------------------------------------------------
+void StateCache::ForgetVertexArray(GLuint vertexArrayID)
+{
+
+	if (m_vertexArrayID == vertexArrayID)
+	{
+		m_vertexArrayID = 0;
+	}
+
+	m_attributeMasks.erase(vertexArrayID);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that resets the texture binding if the deleted texture passed was bound
+//------------------------------------------------------------------------------------------------------
+void StateCache::ForgetTexture(GLuint textureID)
+{
+
+	if (m_textureID == textureID)
+	{
+		m_textureID = 0;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that resets the active program if the deleted program passed was active
+//------------------------------------------------------------------------------------------------------
+void StateCache::ForgetProgram(GLuint programID)
+{
+
+	if (m_programID == programID)
+	{
+		m_programID = 0;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that stores the counts of the previous frame and starts counting again
+//------------------------------------------------------------------------------------------------------
+void StateCache::BeginFrame()
+{
+
+	m_lastTotalIssued = m_totalIssued;
+	m_lastTotalSkipped = m_totalSkipped;
+
+	m_totalIssued = 0;
+	m_totalSkipped = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that counts the call as either sent or skipped and returns if it needs to be sent
+//------------------------------------------------------------------------------------------------------
+bool StateCache::IsChanged(bool isChanged)
+{
+
+	if (isChanged)
+	{
+		m_totalIssued++;
+	}
+
+	else
+	{
+		m_totalSkipped++;
+	}
+
+	return isChanged;
+
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class keeps track of which VBO, VAO, texture and shader program are currently bound in
+  OpenGL, and which shader attributes are switched on, so that binding something that is already 
+  bound is skipped instead of being sent to the driver. Each of these calls costs CPU time in the
+  driver, even if nothing changes, and drawing a single sprite used to make about a dozen of them.
+  The Buffer, Texture and Shader Manager classes make all their binding calls through this class,
+  which is a Singleton.
+
+- Which shader attributes are switched on is stored inside the VAO that is bound at the time, so 
+  the switched on attributes are kept track of separately for each VAO, including VAO 0 for when
+  no VAO is bound. Only attributes 0 to 31 are kept track of, all others are always sent.
+
+- The engine only ever uses the first texture unit, so textures are only kept track of for that 
+  unit. The element array buffer binding is also part of the VAO, so it is not kept track of here.
+
+- When OpenGL objects are deleted, any bindings to them are reset to 0 by OpenGL, so the managers
+  need to call the relevant Forget() routine after deleting an object, otherwise the cache would
+  skip binding a new object that happens to be given the same ID.
+
+- The amount of calls sent to OpenGL and the amount skipped are counted. The BeginFrame() routine,
+  called by the Game class each frame, stores the counts of the previous frame and starts counting
+  again, and the two getter functions return the counts of the previous frame.
+
+*/
+
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+#include <map>
+#include <OpenGL.h>
+#include "Singleton.h"
+
+class StateCache
+{
+
+public:
+
+	friend class Singleton<StateCache>;
+
+public:
+
+	int GetTotalIssued();
+	int GetTotalSkipped();
+
+public:
+
+	void BindBuffer(GLuint bufferID);
+	void BindVertexArray(GLuint vertexArrayID);
+	void BindTexture(GLuint textureID);
+	void UseProgram(GLuint programID);
+
+public:
+
+	void EnableAttribute(GLint attributeID);
+	void DisableAttribute(GLint attributeID);
+
+public:
+
+	void ForgetBuffer(GLuint bufferID);
+	void ForgetVertexArray(GLuint vertexArrayID);
+	void ForgetTexture(GLuint textureID);
+	void ForgetProgram(GLuint programID);
+
+public:
+
+	void BeginFrame();
+
+private:
+
+	StateCache();
+	StateCache(const StateCache&);
+	StateCache& operator=(const StateCache&);
+
+private:
+
+	bool IsChanged(bool isChanged);
+
+private:
+
+	int m_totalIssued;
+	int m_totalSkipped;
+	int m_lastTotalIssued;
+	int m_lastTotalSkipped;
+
+	GLuint m_bufferID;
+	GLuint m_vertexArrayID;
+	GLuint m_textureID;
+	GLuint m_programID;
+
+	std::map<GLuint, unsigned int> m_attributeMasks;
+
+};
+
+typedef Singleton<StateCache> TheStateCache;
+
+#endif
\ No newline at end of file
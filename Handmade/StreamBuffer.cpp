@@ -0,0 +1,290 @@
+#include <iostream>
+#include <string.h>
+#include "BufferManager.h"
+#include "ScreenManager.h"
+#include "StreamBuffer.h"
+
+//------------------------------------------------------------------------------------------------------
+//constructor that assigns all default values
+//------------------------------------------------------------------------------------------------------
+StreamBuffer::StreamBuffer()
+{
+
+	m_isPersistent = false;
+
+	m_segment = 0;
+	m_frame = 0;
+
+	m_bufferID = 0;
+	m_mappedData = 0;
+
+	m_segmentSize = 0;
+	m_writeOffset = 0;
+	m_uploadOffset = 0;
+
+	for (int i = 0; i < TOTAL_SEGMENTS; i++)
+	{
+		m_fences[i] = 0;
+	}
+
+}
+//------------------------------------------------------------------------------------------------------
+//predicate function that checks if buffer is mapped persistently
+//------------------------------------------------------------------------------------------------------
+bool StreamBuffer::IsPersistent()
+{
+
+	return m_isPersistent;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns OpenGL ID of streaming VBO
+//------------------------------------------------------------------------------------------------------
+GLuint StreamBuffer::GetBufferID()
+{
+
+	return m_bufferID;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns number of current frame
+//------------------------------------------------------------------------------------------------------
+unsigned int StreamBuffer::GetFrame()
+{
+
+	return m_frame;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates the streaming VBO, mapping it persistently if supported
+//------------------------------------------------------------------------------------------------------
+bool StreamBuffer::Initialize(GLsizeiptr segmentSize)
+{
+
+	//there is no OpenGL context to create the VBO with in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
+
+	m_segmentSize = segmentSize;
+	m_isPersistent = (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage);
+
+	glGenBuffers(1, &m_bufferID);
+	TheBuffer::Instance()->Enable(m_bufferID);
+
+	//create fixed storage for all segments and keep it mapped for good
+	if (m_isPersistent)
+	{
+
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glBufferStorage(GL_ARRAY_BUFFER, m_segmentSize * TOTAL_SEGMENTS, 0, flags);
+		m_mappedData = (GLubyte*)glMapBufferRange(GL_ARRAY_BUFFER, 0, 
+			                                      m_segmentSize * TOTAL_SEGMENTS, flags);
+
+		//the fixed storage cannot be resized, so start over with a new 
+		//buffer that is uploaded to in one go each time it is drawn from
+		if (!m_mappedData)
+		{
+
+			std::cout << "Streaming buffer could not be mapped, uploading data instead." << std::endl;
+			std::cout << "---------------------------------------------------------------" << std::endl;
+
+			TheBuffer::Instance()->DestroyBuffer(m_bufferID);
+			glGenBuffers(1, &m_bufferID);
+			TheBuffer::Instance()->Enable(m_bufferID);
+
+			m_isPersistent = false;
+
+		}
+
+	}
+
+	//otherwise create storage that is orphaned each time the ring starts 
+	//over and a copy of one segment in normal memory to write to first
+	if (!m_isPersistent)
+	{
+		glBufferData(GL_ARRAY_BUFFER, m_segmentSize * TOTAL_SEGMENTS, 0, GL_STREAM_DRAW);
+		m_stagingData.resize((size_t)m_segmentSize);
+	}
+
+	TheBuffer::Instance()->Disable();
+
+	return true;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that makes sure the current segment is no longer used by OpenGL before writing to it
+//------------------------------------------------------------------------------------------------------
+void StreamBuffer::BeginFrame()
+{
+
+	if (!m_bufferID)
+	{
+		return;
+	}
+
+	//wait for the graphics card to finish drawing from the segment, 
+	//flushing the command queue so that the fence is sure to be reached
+	if (m_isPersistent && m_fences[m_segment])
+	{
+
+		while (glClientWaitSync(m_fences[m_segment], GL_SYNC_FLUSH_COMMANDS_BIT, 
+			                    1000000) == GL_TIMEOUT_EXPIRED) {}
+
+		glDeleteSync(m_fences[m_segment]);
+		m_fences[m_segment] = 0;
+
+	}
+
+	//hand the old memory to the driver and start writing to fresh memory
+	else if (!m_isPersistent && m_segment == 0)
+	{
+		TheBuffer::Instance()->Enable(m_bufferID);
+		glBufferData(GL_ARRAY_BUFFER, m_segmentSize * TOTAL_SEGMENTS, 0, GL_STREAM_DRAW);
+		TheBuffer::Instance()->Disable();
+	}
+
+	m_writeOffset = 0;
+	m_uploadOffset = 0;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that copies the data passed into the current segment and returns its offset in bytes
+//------------------------------------------------------------------------------------------------------
+GLint StreamBuffer::Write(const std::vector<GLfloat>& data, GLsizeiptr alignment)
+{
+
+	if (data.empty())
+	{
+		return -1;
+	}
+
+	return Write(&data[0], sizeof(GLfloat) * data.size(), alignment);
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that copies the raw bytes passed into the current segment and returns their offset in bytes
+//------------------------------------------------------------------------------------------------------
+GLint StreamBuffer::Write(const void* data, GLsizeiptr size, GLsizeiptr alignment)
+{
+
+	if (!m_bufferID || size == 0)
+	{
+		return -1;
+	}
+
+	GLsizeiptr segmentStart = m_segmentSize * m_segment;
+
+	//round the start up to the next multiple of the alignment
+	GLsizeiptr offset = segmentStart + m_writeOffset;
+	offset = ((offset + alignment - 1) / alignment) * alignment;
+
+	//there is no room left in the segment for this frame
+	if (offset + size > segmentStart + m_segmentSize)
+	{
+		return -1;
+	}
+
+	//without a persistent mapping the data is gathered in normal memory until it is uploaded
+	if (m_isPersistent)
+	{
+		memcpy(m_mappedData + offset, data, size);
+	}
+
+	else
+	{
+		memcpy(&m_stagingData[(size_t)(offset - segmentStart)], data, size);
+	}
+
+	m_writeOffset = offset + size - segmentStart;
+
+	return (GLint)offset;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that sends all data written since the last upload to the VBO in one go
+//------------------------------------------------------------------------------------------------------
+void StreamBuffer::Upload()
+{
+
+	if (!m_bufferID || m_isPersistent || m_uploadOffset == m_writeOffset)
+	{
+		return;
+	}
+
+	GLsizeiptr size = m_writeOffset - m_uploadOffset;
+
+	TheBuffer::Instance()->Enable(m_bufferID);
+
+	//map only the range written to, without waiting for the graphics 
+	//card, because it never uses that range in the current frame
+	void* mappedData = glMapBufferRange(GL_ARRAY_BUFFER, m_segmentSize * m_segment + m_uploadOffset, 
+		                                size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | 
+		                                GL_MAP_UNSYNCHRONIZED_BIT);
+
+	if (mappedData)
+	{
+		memcpy(mappedData, &m_stagingData[(size_t)m_uploadOffset], size);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	TheBuffer::Instance()->Disable();
+
+	m_uploadOffset = m_writeOffset;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that fences off the current segment and moves on to the next one
+//------------------------------------------------------------------------------------------------------
+void StreamBuffer::EndFrame()
+{
+
+	if (!m_bufferID)
+	{
+		return;
+	}
+
+	//mark the point in the command queue after which the segment is free again
+	if (m_isPersistent)
+	{
+		m_fences[m_segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	m_segment = (m_segment + 1) % TOTAL_SEGMENTS;
+	m_frame++;
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that unmaps and destroys the streaming VBO
+//------------------------------------------------------------------------------------------------------
+void StreamBuffer::ShutDown()
+{
+
+	if (!m_bufferID)
+	{
+		return;
+	}
+
+	for (int i = 0; i < TOTAL_SEGMENTS; i++)
+	{
+		if (m_fences[i])
+		{
+			glDeleteSync(m_fences[i]);
+			m_fences[i] = 0;
+		}
+	}
+
+	if (m_mappedData)
+	{
+		TheBuffer::Instance()->Enable(m_bufferID);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		TheBuffer::Instance()->Disable();
+		m_mappedData = 0;
+	}
+
+	TheBuffer::Instance()->DestroyBuffer(m_bufferID);
+	m_bufferID = 0;
+
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class encapsulates one big streaming VBO that all vertex data that changes every frame is
+  written into, like that of dynamic sprites, text and animations. Filling a separate VBO with
+  glBufferData() for each of these every frame makes the driver throw away and reallocate memory
+  hundreds of times per frame. Instead, this buffer is split into three segments, and each frame
+  writes all its data one after the other into the next segment, like a ring. This class is a 
+  Singleton.
+
+- Where the graphics card supports it (OpenGL 4.4 or ARB_buffer_storage), the entire buffer is 
+  mapped into memory once and stays mapped, so writing data is simply a memory copy. Because the 
+  graphics card may still be drawing from a segment that was written to two frames ago, a fence 
+  is placed in the OpenGL command queue at the end of each frame, and before a segment is written 
+  to again the BeginFrame() routine waits for its fence, which normally has long passed.
+  Otherwise, or if the buffer cannot be mapped for good, the data written is first gathered in a
+  copy of the segment in normal memory, and the Upload() routine sends everything written since
+  the last upload in one go, mapping the range without OpenGL waiting for the graphics card. A
+  buffer cannot be drawn from while it is mapped this way, so Upload() is called right before a
+  draw call needs the data. The buffer is orphaned each time the ring starts over at the first 
+  segment. Orphaning hands the old memory over to the driver, which frees it once the graphics 
+  card is done with it, and gives the buffer fresh memory to write to.
+
+- The Write() function copies the data passed into the current segment and returns where in the
+  buffer the data starts, in bytes, or -1 if the segment is full. The start is always a multiple of
+  the alignment passed, which should be the size of one vertex, so that the data can be drawn by 
+  simply telling OpenGL which vertex to start from. A second version takes raw bytes instead, for
+  vertex data that is not made up of floats only. The GetFrame() function returns a number that
+  changes every frame, so that buffers know when their data in the ring is out of date.
+
+- The BeginFrame() and EndFrame() routines need to be called before and after drawing each frame,
+  which is done by the Game class. When the screen runs in headless mode no buffer is created.
+
+*/
+
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <vector>
+#include <OpenGL.h>
+#include "Singleton.h"
+
+//amount of frames that may be in flight at any one time
+const int TOTAL_SEGMENTS = 3;
+
+class StreamBuffer
+{
+
+public:
+
+	friend class Singleton<StreamBuffer>;
+
+public:
+
+	bool IsPersistent();
+	GLuint GetBufferID();
+	unsigned int GetFrame();
+
+public:
+
+	bool Initialize(GLsizeiptr segmentSize = 4194304);
+	void BeginFrame();
+	GLint Write(const std::vector<GLfloat>& data, GLsizeiptr alignment);
+	GLint Write(const void* data, GLsizeiptr size, GLsizeiptr alignment);
+	void Upload();
+	void EndFrame();
+	void ShutDown();
+
+private:
+
+	StreamBuffer();
+	StreamBuffer(const StreamBuffer&);
+	StreamBuffer& operator=(const StreamBuffer&);
+
+private:
+
+	bool m_isPersistent;
+
+	int m_segment;
+	unsigned int m_frame;
+
+	GLuint m_bufferID;
+	GLubyte* m_mappedData;
+
+	GLsizeiptr m_segmentSize;
+	GLsizeiptr m_writeOffset;
+	GLsizeiptr m_uploadOffset;
+	std::vector<GLubyte> m_stagingData;
+
+	GLsync m_fences[TOTAL_SEGMENTS];
+
+};
+
+typedef Singleton<StreamBuffer> TheStreamBuffer;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include <iostream>
+#include "Tag.h"
+
+std::mutex Tag::s_mutex;
+std::unordered_map<TagID, std::string> Tag::s_names;
+
+//------------------------------------------------------------------------------------------------------
+//static function that hashes the name passed and remembers it for later lookup
+//------------------------------------------------------------------------------------------------------
+TagID Tag::Intern(const std::string& name)
+{
+
+	TagID tagID = Hash(name.c_str());
+
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	auto it = s_names.find(tagID);
+
+	//if ID is new, store the name, otherwise make sure it was not stored for another name
+	if (it == s_names.end())
+	{
+		s_names[tagID] = name;
+	}
+
+	else if (it->second != name)
+	{
+		std::cout << "Tags \"" << it->second << "\" and \"" << name << "\" have the same ID." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+	}
+
+	return tagID;
+
+}
+//------------------------------------------------------------------------------------------------------
+//static function that returns the name of the tag ID passed, or an empty name if never interned
+//------------------------------------------------------------------------------------------------------
+const std::string& Tag::GetName(TagID tagID)
+{
+
+	static const std::string s_noName;
+
+	std::lock_guard<std::mutex> lock(s_mutex);
+
+	auto it = s_names.find(tagID);
+
+	return (it != s_names.end() ? it->second : s_noName);
+
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*
+
+  All code has been written by Karsten Vermeulen and may be used freely by anyone. It is by no
+  means perfect and there is certainly room for improvement in some parts. As a whole, the code
+  has been created as part of an engine for the purposes of educating other fellow programmers,
+  and anyone else wishing to learn C++ and OOP. Feel free to use, copy, break, update and do as
+  you wish with this code - it is there for all!
+
+  UPDATED : October 2026
+
+  -----------------------------------------------------------------------------------------------
+
+- This class turns game object tags into plain numbers, so that tags can be compared and looked up
+  without copying or comparing any strings. A tag ID is the 32-bit FNV-1a hash of the tag's name.
+  The Hash() function is constexpr, so when its result is used where a constant is required, like
+  a constexpr TagID or a case label, the compiler works out the ID and no hashing is done while the
+  game runs. Anywhere else, including names passed in as strings such as SetTag(std::string), the 
+  name is hashed at runtime, which is still cheap but not free. The empty tag always has an ID of
+  NONE.
+
+- The Intern() function hashes the name passed at runtime and remembers the name, so that it can
+  later be found again from the ID with GetName(). This is only needed for tags whose name needs to
+  be displayed or that are read in from file. If two different names end up with the same ID, a
+  message is displayed, so that one of the tags can be renamed. Both functions are thread safe.
+
+- All functions are static because the tags are shared by all game objects in all game states.
+
+*/
+
+#ifndef TAG_H
+#define TAG_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+typedef unsigned int TagID;
+
+class Tag
+{
+
+public:
+
+	static const TagID NONE = 0;
+
+public:
+
+	static constexpr TagID Hash(const char* name)
+	{
+		return (*name ? HashFrom(name, 2166136261u) : NONE);
+	}
+
+public:
+
+	static TagID Intern(const std::string& name);
+	static const std::string& GetName(TagID tagID);
+
+private:
+
+	static constexpr TagID HashFrom(const char* name, TagID hash)
+	{
+		return (*name ? HashFrom(name + 1, (hash ^ (unsigned char)*name) * 16777619u) : hash);
+	}
+
+private:
+
+	static std::mutex s_mutex;
+	static std::unordered_map<TagID, std::string> s_names;
+
+};
+
+#endif
\ No newline at end of file
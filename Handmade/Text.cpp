@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <OpenGL.h>
 #include "ScreenManager.h"
 #include "ShaderManager.h"
@@ -13,8 +14,13 @@ Text::Text()
 	m_spriteType = DYNAMIC;
 
 	//set other default values
+	m_isTextDirty = true;
 	m_text = "";
 	m_charSpace = 0.0f;
+	m_createdText = "";
+
+	//text only changes now and then so its data is not streamed
+	m_buffer.IsStreamed() = false;
 	
 	//default font texture dimensions are set to 16x16
 	//as is setup in the Bitmap Font Builder textures
@@ -37,7 +43,12 @@ void Text::SetText(const std::string& text)
 void Text::SetCharSpace(GLfloat charSpace)
 {
 
-	m_charSpace = charSpace;
+	//all characters move when the spacing changes
+	if (charSpace != m_charSpace)
+	{
+		m_charSpace = charSpace;
+		m_isTextDirty = true;
+	}
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -51,34 +62,105 @@ void Text::Draw()
 	if (m_spriteType == DYNAMIC || (m_spriteType == STATIC && !m_isSpriteCreated))
 	{
 
-		//clear all buffer data from vectors
-		ClearBufferData();
+		//anything that changes all characters means creating them all again
+		//if only the string changed, only the changed characters are replaced
+		if (m_isTextDirty || IsDataChanged())
+		{
+			CreateText();
+		}
 
-		//loop through the entire text string and 
-		//create buffer data for each character
-		for (int i = 0; i < m_text.size(); i++)
+		else if (m_text != m_createdText)
 		{
+			UpdateText();
+		}
 
-			//the texture index is the actual ASCII value of the letter
-			m_textureIndex = m_text[i];
+	}
+
+	//create and draw the sprite
+	CreateSprite();
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that creates the buffer data for all characters in the string text
+//------------------------------------------------------------------------------------------------------
+void Text::CreateText()
+{
+
+	//clear all buffer data from vectors
+	ClearBufferData();
+
+	//loop through the entire text string and 
+	//create buffer data for each character
+	for (size_t i = 0; i < m_text.size(); i++)
+	{
+
+		//the texture index is the actual ASCII value of the letter
+		m_textureIndex = m_text[i];
+
+		//create the vertex, texture and color buffer data
+		CreateVertices(i);
+		CreateTexCoords();
+		CreateColors();
+
+	}
+
+	//remember what the buffer data was created with
+	m_isTextDirty = false;
+	m_createdText = m_text;
+	StoreCreatedData();
+
+	//flag the VBO to be filled with the buffer data
+	m_buffer.FillData(Buffer::COLOR_BUFFER);
+	m_buffer.FillData(Buffer::VERTEX_BUFFER);
+	m_buffer.FillData(Buffer::TEXTURE_BUFFER);
 
-			//create the vertex, texture and color buffer data
-			CreateVertices(i);
-			CreateTexCoords();
-			CreateColors();
+}
+//------------------------------------------------------------------------------------------------------
+//function that only changes the buffer data of the characters that are different
+//------------------------------------------------------------------------------------------------------
+void Text::UpdateText()
+{
+
+	size_t totalCreated = m_createdText.size();
+	size_t totalCharacters = m_text.size();
+	size_t totalShared = (totalCharacters < totalCreated ? totalCharacters : totalCreated);
+
+	//characters in the same place only need new texture coordinates if they are different
+	for (size_t i = 0; i < totalShared; i++)
+	{
 
+		if (m_text[i] != m_createdText[i])
+		{
+			m_textureIndex = m_text[i];
+			UpdateTexCoords(i);
 		}
 
-		//fill the VBOs with the buffer data
-		FillBuffers();
+	}
 
-		//set flag so that static sprites are not created again
-		m_isSpriteCreated = true;
+	//add any new characters to the end
+	for (size_t i = totalShared; i < totalCharacters; i++)
+	{
+		m_textureIndex = m_text[i];
+		CreateVertices(i);
+		CreateTexCoords();
+		CreateColors();
+	}
 
+	//remove any characters that are no longer there from the end
+	//each character is made up of six vertices
+	if (totalCharacters < totalCreated)
+	{
+		m_buffer.Vertices().resize(totalCharacters * 6 * Buffer::XY);
+		m_buffer.Colors().resize(totalCharacters * 6 * Buffer::RGBA);
+		m_buffer.Textures().resize(totalCharacters * 6 * Buffer::UV);
 	}
 
-	//create and draw the sprite
-	CreateSprite();
+	m_createdText = m_text;
+
+	//flag the VBO to be filled with the buffer data
+	m_buffer.FillData(Buffer::COLOR_BUFFER);
+	m_buffer.FillData(Buffer::VERTEX_BUFFER);
+	m_buffer.FillData(Buffer::TEXTURE_BUFFER);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -120,4 +202,23 @@ void Text::CreateVertices(int characterIndex)
 	m_buffer.Vertices().push_back(characterOrigin + halfDimension.X);
 	m_buffer.Vertices().push_back(-halfDimension.Y);
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that replaces texture coordinate data of one character in buffer object's vector
+//------------------------------------------------------------------------------------------------------
+void Text::UpdateTexCoords(int characterIndex)
+{
+
+	//create the new texture coordinates at the end of the vector 
+	//and then move them in place of the character's old ones
+	std::vector<GLfloat>& textures = m_buffer.Textures();
+	int totalTexCoords = 6 * Buffer::UV;
+
+	CreateTexCoords();
+
+	std::copy(textures.end() - totalTexCoords, textures.end(), 
+		      textures.begin() + characterIndex * totalTexCoords);
+
+	textures.resize(textures.size() - totalTexCoords);
+
 }
\ No newline at end of file
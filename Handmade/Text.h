@@ -29,6 +29,14 @@
   be called multiple times from within the Draw() routine, once for each character in the string 
   text. 
 
+- Text objects remember the string, color and dimensions their buffer data was last created with,
+  and the Draw() routine only creates the data again when any of these have changed, instead of
+  every frame. When only the string has changed, which is the case for things like score counters,
+  only the texture coordinates of the characters that are different are replaced, and characters
+  are added to or removed from the end if the string length changed. Any change in color, character
+  spacing, sprite or texture dimension creates the data of all characters again. Because text does
+  not change every frame, its data is kept in the buffer's own VBO instead of being streamed.
+
 */
 
 #ifndef TEXT_H
@@ -56,13 +64,20 @@ public :
 
 private :
 
+	void CreateText();
+	void UpdateText();
 	void CreateVertices(int characterIndex);
+	void UpdateTexCoords(int characterIndex);
 	
 private :
 	
+	bool m_isTextDirty;
+
 	std::string m_text;
 	GLfloat m_charSpace;
 
+	std::string m_createdText;
+
 };
 
 #endif
\ No newline at end of file
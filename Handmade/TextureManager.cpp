@@ -1,14 +1,36 @@
 #include <iostream>
 #include <SDL_image.h>
+#include "ScreenManager.h"
+#include "StateCache.h"
 #include "TextureManager.h"
 
 //------------------------------------------------------------------------------------------------------
-//getter function that returns texture ID based on texture map index passed 
+//getter function that returns texture handle based on texture map index passed 
 //------------------------------------------------------------------------------------------------------
-GLuint TextureManager::GetTextureID(const std::string& mapIndex)
+Handle TextureManager::GetTexture(const std::string& mapIndex)
 {
 
-	return m_textureIDMap[mapIndex];
+	auto it = m_textureHandleMap.find(mapIndex);
+
+	//if texture does not exist, display error message and return a null handle
+	if (it == m_textureHandleMap.end())
+	{
+		std::cout << "Texture \"" << mapIndex << "\" does not exist." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return Handle();
+	}
+
+	return it->second;
+
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns texture ID based on texture handle passed or 0 if it is stale
+//------------------------------------------------------------------------------------------------------
+GLuint TextureManager::GetTextureID(Handle texture)
+{
+
+	GLuint* ID = m_textureIDs.Get(texture);
+	return (ID ? *ID : 0);
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -17,16 +39,50 @@ GLuint TextureManager::GetTextureID(const std::string& mapIndex)
 void TextureManager::Enable(GLuint textureID)
 {
 
-	glBindTexture(GL_TEXTURE_2D, textureID);
+	TheStateCache::Instance()->BindTexture(textureID);
 
 }
 //------------------------------------------------------------------------------------------------------
-//function that deactivates all textures by binding texture to NULL
+//function that deactivates all textures
 //------------------------------------------------------------------------------------------------------
 void TextureManager::Disable()
 {
 
-	glBindTexture(GL_TEXTURE_2D, 0);
+	//the texture is left bound, because all textures are bound through the state 
+	//cache before they are used, so unbinding it would only be a wasted call
+
+}
+//------------------------------------------------------------------------------------------------------
+//function that loads and decodes a raw image file without creating an OpenGL texture
+//------------------------------------------------------------------------------------------------------
+bool TextureManager::Preload(const std::string& filename)
+{
+
+	SDL_Surface* textureData = 0;
+
+	//there is no OpenGL context to load textures into in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
+
+	//load texture from file using SDL image load function
+	textureData = IMG_Load(filename.c_str());
+
+	//if texture loading failed, display error message 
+	if (!textureData)
+	{
+		std::cout << "File \"" << filename << "\" could not be preloaded." << std::endl;
+		std::cout << "---------------------------------------------------------------" << std::endl;
+		return false;
+	}
+
+	//keep image data aside until the texture is created on the main thread
+	m_preloadMutex.lock();
+	m_preloadDataMap[filename] = textureData;
+	m_preloadMutex.unlock();
+
+	return true;
 
 }
 //------------------------------------------------------------------------------------------------------
@@ -45,11 +101,32 @@ bool TextureManager::LoadFromFile(const std::string& filename, const std::string
 	GLuint ID = 0;
 	SDL_Surface* textureData = 0;
 
+	//there is no OpenGL context to load textures into in headless mode
+	if (TheScreen::Instance()->IsHeadless())
+	{
+		return true;
+	}
+
 	//display text to state that file is being opened and read
 	std::cout << "Opening and reading texture file : " << "\"" << filename << "\"" << std::endl;
 
-	//load texture from file using SDL image load function
-	textureData = IMG_Load(filename.c_str());
+	//if the image has already been preloaded use that image data
+	m_preloadMutex.lock();
+	auto it = m_preloadDataMap.find(filename);
+
+	if (it != m_preloadDataMap.end())
+	{
+		textureData = it->second;
+		m_preloadDataMap.erase(it);
+	}
+
+	m_preloadMutex.unlock();
+
+	//otherwise load texture from file using SDL image load function
+	if (!textureData)
+	{
+		textureData = IMG_Load(filename.c_str());
+	}
 
 	//if texture loading failed, display error message 
 	if (!textureData)
@@ -75,7 +152,7 @@ bool TextureManager::LoadFromFile(const std::string& filename, const std::string
 
 		//link the newly created ID with the texture data we 
 		//are about to send to OpenGL  
-		glBindTexture(GL_TEXTURE_2D, ID);
+		Enable(ID);
 
 		//set parameters
 		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -88,11 +165,15 @@ bool TextureManager::LoadFromFile(const std::string& filename, const std::string
 		SDL_FreeSurface(textureData);
 
 		//unlink texture
-		glBindTexture(GL_TEXTURE_2D, 0);
+		Disable();
+
+		//if a texture is already loaded under the same name, unload it first, 
+		//so that any handles still referring to the old texture become stale
+		UnloadFromMemory(CUSTOM_TEXTURE, mapIndex);
 
-		//assign texture ID to map
+		//store texture ID in slot map and its handle in the map
 		//now the ID is linked to the image data in OpenGL
-		m_textureIDMap[mapIndex] = ID;
+		m_textureHandleMap[mapIndex] = m_textureIDs.Add(ID);
 
 	}
 
@@ -109,38 +190,52 @@ bool TextureManager::LoadFromFile(const std::string& filename, const std::string
 void TextureManager::UnloadFromMemory(RemoveType removeType, const std::string& mapIndex)
 {
 
-	//loop through entire texture map in order 
-	//to remove a specific texture or all textures
-	for (auto it = m_textureIDMap.begin(); it != m_textureIDMap.end(); it++)
+	//there is no OpenGL context to unload textures from in headless mode
+	if (TheScreen::Instance()->IsHeadless())
 	{
+		return;
+	}
 
-		//if a flag is passed to remove a specific texture
-		//check if map index is the texture that needs to be removed
-		//and remove it from both OpenGL and the map
-		if (removeType == CUSTOM_TEXTURE)
-		{
-			if (it->first == mapIndex)
-			{
-				glDeleteTextures(1, &(it->second));
-				m_textureIDMap.erase(it);
-				break;
-			}
-		}
+	//if a flag is passed to remove a specific texture find it by its map index 
+	//and remove it from OpenGL, the slot map and the map, making its handles stale
+	if (removeType == CUSTOM_TEXTURE)
+	{
 
-		//otherwise if a flag is passed to remove all textures
-		//remove the texture from OpenGL
-		else if (removeType == ALL_TEXTURES)
+		auto it = m_textureHandleMap.find(mapIndex);
+
+		if (it != m_textureHandleMap.end())
 		{
-			glDeleteTextures(1, &(it->second));
+			GLuint ID = GetTextureID(it->second);
+			glDeleteTextures(1, &ID);
+			TheStateCache::Instance()->ForgetTexture(ID);
+			m_textureIDs.Remove(it->second);
+			m_textureHandleMap.erase(it);
 		}
 
 	}
 
-	//if all textures have been removed from OpenGL, clear the 
-	//entire map in one go, because the IDs in the map still remain
-	if (removeType == ALL_TEXTURES)
+	//otherwise if a flag is passed to remove all textures remove them all
+	//from OpenGL, then clear the slot map and the map in one go
+	//also free any preloaded images that were never turned into textures
+	else if (removeType == ALL_TEXTURES)
 	{
-		m_textureIDMap.clear();
+
+		m_textureIDs.ForEach([](GLuint& ID) { glDeleteTextures(1, &ID); 
+		                                      TheStateCache::Instance()->ForgetTexture(ID); });
+
+		m_textureIDs.Clear();
+		m_textureHandleMap.clear();
+
+		m_preloadMutex.lock();
+
+		for (auto it = m_preloadDataMap.begin(); it != m_preloadDataMap.end(); it++)
+		{
+			SDL_FreeSurface(it->second);
+		}
+
+		m_preloadDataMap.clear();
+		m_preloadMutex.unlock();
+
 	}
 
 }
@@ -154,13 +249,13 @@ void TextureManager::Output()
 	system("cls");
 	
 	//display total amount of texture IDs stored in map
-	std::cout << "Size of Texture ID Map : " << m_textureIDMap.size() << std::endl;
+	std::cout << "Size of Texture ID Map : " << m_textureIDs.GetSize() << std::endl;
 	std::cout << "------------------------------" << std::endl;
 
 	//loop through map and display each texture detailing its OpenGL ID and tag name
-	for (auto it = m_textureIDMap.begin(); it != m_textureIDMap.end(); it++)
+	for (auto it = m_textureHandleMap.begin(); it != m_textureHandleMap.end(); it++)
 	{
-		std::cout << it->second << " : " << it->first << std::endl;
+		std::cout << GetTextureID(it->second) << " : " << it->first << std::endl;
 	}
 
 }
\ No newline at end of file
@@ -11,7 +11,7 @@
   -----------------------------------------------------------------------------------------------
 
 - This class encapsulates a texture manager which will load images from disk and store them as 
-  OpenGL integer IDs in a map, with a string reference to that texture. The images are loaded 
+  OpenGL integer IDs in a slot map, with a string reference to that texture. The images are loaded 
   using SDL's image loading function and generated through OpenGL to produce an ID that is needed
   to use that image. Currently the images supported are BMP, PNG, JPG, GIF, TGA. <TBA>. To access a 
   particular image inside the map the string reference is needed to sift through the map and find 
@@ -21,12 +21,24 @@
 - Two enum types have been created to be used when removing texture images from the map. Either
   one single specific texture can be removed, or the entire map of textures can be cleared.
 
-- To use this class, an object in the client code will need to link to a specific texture ID
-  from within the Texture Manager. The GetTextureID() function is used to request the OpenGL ID
-  and link the texture data with the external object. 
+- To use this class, an object in the client code will need to link to a specific texture from 
+  within the Texture Manager. The GetTexture() function is used once to look up the texture by its
+  string reference and returns a handle to it, or a null handle if there is no such texture. The 
+  GetTextureID() function then returns the OpenGL ID from the handle each time the texture is used,
+  which is a simple array lookup. If the texture has been unloaded or loaded again since, the handle
+  is stale and the ID returned is 0, so that nothing is textured instead of using the wrong texture.
+
+- The Preload() routine loads and decodes an image file without sending it to OpenGL, so that it 
+  may be called on a loading thread. The decoded image is kept aside and when LoadFromFile() is later
+  called with the same filename on the main thread, it only needs to create the OpenGL texture.
 
 - The Enable() and Disable() routines activate and de-activate a specific texture respectively, 
-  and this needs to be done before a specific texture can be used.
+  and this needs to be done before a specific texture can be used. Textures are bound through the
+  state cache, which skips binding a texture that is already bound, and the Disable() routine 
+  leaves the texture bound, because the next texture used is bound over it anyway.
+
+- When the screen runs in headless mode there is no OpenGL context, so no textures are loaded or
+  unloaded at all.
 
 - An Output() routine is there for debug purposes only and will print to the console how many texture 
   IDs are currently stored in the map, as well as detailing each one.
@@ -37,9 +49,12 @@
 #define TEXTURE_MANAGER_H
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <OpenGL.h>
+#include <SDL.h>
 #include "Singleton.h"
+#include "SlotMap.h"
 
 class TextureManager
 {
@@ -54,7 +69,8 @@ public :
 
 public:
 
-	GLuint GetTextureID(const std::string& mapIndex);
+	Handle GetTexture(const std::string& mapIndex);
+	GLuint GetTextureID(Handle texture);
 
 public:
 
@@ -63,6 +79,7 @@ public:
 
 public:
 
+	bool Preload(const std::string& filename);
 	bool LoadFromFile(const std::string& filename, const std::string& mapIndex);
 	void UnloadFromMemory(RemoveType removeType, const std::string& mapIndex = "");
 
@@ -78,7 +95,11 @@ private :
 
 private :
 
-	std::map<std::string, GLuint> m_textureIDMap;
+	SlotMap<GLuint> m_textureIDs;
+	std::map<std::string, Handle> m_textureHandleMap;
+
+	std::mutex m_preloadMutex;
+	std::map<std::string, SDL_Surface*> m_preloadDataMap;
 	
 };
 
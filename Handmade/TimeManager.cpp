@@ -11,6 +11,15 @@ TimeManager::TimeManager()
 
 	Reset();
 
+}
+//------------------------------------------------------------------------------------------------------
+//getter function that returns the real time the last frame took in seconds
+//------------------------------------------------------------------------------------------------------
+double TimeManager::GetFrameTimeSeconds() const
+{
+
+	return m_frameTimeSeconds;
+
 }
 //------------------------------------------------------------------------------------------------------
 //getter function that returns time elapsed in milliseconds
@@ -83,6 +92,19 @@ double TimeManager::GetTotalTimeHours() const
 
 	return m_totalTimeHours;
 
+}
+//------------------------------------------------------------------------------------------------------
+//setter function that overrides the elapsed time with the value passed
+//------------------------------------------------------------------------------------------------------
+void TimeManager::SetElapsedTime(double milliseconds)
+{
+
+	//convert elapsed time from milliseconds into four time formats
+	m_elapsedTimeMilliseconds = milliseconds;
+	m_elapsedTimeSeconds = milliseconds / 1000;
+	m_elapsedTimeMinutes = milliseconds / 60000;
+	m_elapsedTimeHours = milliseconds / 3600000;
+
 }
 //------------------------------------------------------------------------------------------------------
 //function that starts the timer running 
@@ -94,8 +116,8 @@ void TimeManager::Start()
 	//by assigning current SDL clock ticks and timer running flag
 	if (!m_isTimerRunning)
 	{
-		m_startTime = (double)SDL_GetTicks();
-		m_lastTime = (double)SDL_GetTicks();
+		m_startTime = GetTime();
+		m_lastTime = m_startTime;
 		m_isTimerRunning = true;
 	}
 
@@ -128,7 +150,7 @@ void TimeManager::Resume()
 	//by assigning current SDL clock ticks and timer paused flag
 	if (m_isTimerRunning && m_isTimerPaused)
 	{
-		m_lastTime = (double)SDL_GetTicks();
+		m_lastTime = GetTime();
 		m_isTimerPaused = false;
 	}
 
@@ -159,12 +181,15 @@ void TimeManager::Update()
 	if (m_isTimerRunning)
 	{
 
+		//read the current time only once so that both calculations below agree
+		double currentTime = GetTime();
+
 		if (!m_isTimerPaused)
 		{
 			
 			//calculate time passed since last function call 
 			//this uses the current SDL real time and last time recorded earlier
-			double elapsedTime = (double)SDL_GetTicks() - m_lastTime;
+			double elapsedTime = currentTime - m_lastTime;
 
 			//convert elapsed time from milliseconds into four time formats
 			m_elapsedTimeMilliseconds = elapsedTime;
@@ -172,14 +197,17 @@ void TimeManager::Update()
 			m_elapsedTimeMinutes = elapsedTime / 60000;
 			m_elapsedTimeHours = elapsedTime / 3600000;
 
+			//keep a copy that is never overridden for all draw routines
+			m_frameTimeSeconds = m_elapsedTimeSeconds;
+
 			//reset variable for use in next function call
-			m_lastTime = SDL_GetTicks();
+			m_lastTime = currentTime;
 
 		}
 		
 		//calculate total time passed since timer was started
 		//this uses the current SDL real time and start time recorded earlier
-		double totalTime = (double)SDL_GetTicks() - m_startTime;
+		double totalTime = currentTime - m_startTime;
 
 		//convert total time from milliseconds into four time formats
 		m_totalTimeMilliseconds = totalTime;
@@ -248,6 +276,7 @@ void TimeManager::Reset()
 	m_startTime = 0.0;
 	m_lastTime = 0.0;
 
+	m_frameTimeSeconds = 0.0;
 	m_elapsedTimeMilliseconds = 0.0;
 	m_elapsedTimeSeconds = 0.0;
 	m_elapsedTimeMinutes = 0.0;
@@ -258,4 +287,13 @@ void TimeManager::Reset()
 	m_totalTimeMinutes = 0.0;
 	m_totalTimeHours = 0.0;
 
+}
+//------------------------------------------------------------------------------------------------------
+//function that returns the current high precision SDL real time in milliseconds
+//------------------------------------------------------------------------------------------------------
+double TimeManager::GetTime()
+{
+
+	return (double)SDL_GetPerformanceCounter() * 1000.0 / SDL_GetPerformanceFrequency();
+
 }
\ No newline at end of file
@@ -13,6 +13,8 @@
 - This is a Timing class that keeps track of all time passed. It records elapsed time which 
   is great for frame independent games, where physics or graphics updates rely on time instead
   of frame rate. The class also keeps track of total time passed since the game first started.
+  All time is read from SDL's high precision performance counter instead of the millisecond SDL 
+  clock, so that elapsed frame times are measured with sub-millisecond accuracy.
   The class is a Singleton because it is a Manager class and will be accessed from anywhere in 
   the code. The important thing to note is that while the timer can be manually turned on and
   off, the actual SDL time that it relies on will continue to tick. 
@@ -26,6 +28,12 @@
 - All the main elapsed and total timing calculations happen inside the Update() function. This 
   routine needs to be called from inside the main game's Update() routine. 
 
+- The SetElapsedTime() function overrides the elapsed time calculated in Update(). It is used by
+  the Game class when running with a fixed time step, so that all Update() routines that rely on
+  elapsed time are handed the fixed step instead of the real frame time. The GetFrameTimeSeconds()
+  function always returns the real frame time, which is only ever changed by Update() on the main
+  thread, so that draw routines can use it while an update runs on another thread.
+
 - The Output() function is for debug purposes and displays all the time data on the console window.
 
 */
@@ -44,6 +52,7 @@ public:
 
 public:
 
+	double GetFrameTimeSeconds()         const;
 	double GetElapsedTimeMilliseconds()  const;
 	double GetElapsedTimeSeconds()       const;
 	double GetElapsedTimeMinutes()       const;
@@ -54,6 +63,10 @@ public:
 	double GetTotalTimeMinutes()         const;
 	double GetTotalTimeHours()           const;
 
+public:
+
+	void SetElapsedTime(double milliseconds);
+
 public:
 
 	void Start();
@@ -66,6 +79,7 @@ public:
 private:
 
 	void Reset();
+	double GetTime();
 
 private:
 
@@ -81,6 +95,7 @@ private:
 	double m_startTime;
 	double m_lastTime;
 
+	double m_frameTimeSeconds;
 	double m_elapsedTimeMilliseconds;
 	double m_elapsedTimeSeconds;
 	double m_elapsedTimeMinutes;